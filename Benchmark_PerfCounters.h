@@ -0,0 +1,133 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* Hardware counters around the timed loop of a benchmark, so that IPC or cache
+* miss figures come out of the benchmark itself instead of a separate perf run.
+*     perf_counters perf;
+*     perf.start();
+*     for(auto _ : state) { ... }
+*     perf.stop(state);
+* stop() adds cycles, instructions, IPC, L1d_misses, LLC_misses, branch_misses,
+* dTLB_misses and page_faults to state.counters, per iteration. pause() and
+* resume() leave out untimed work inside the loop, next to PauseTiming and
+* ResumeTiming.
+*
+* Every event is opened on its own (perf_event_open, user space only, so
+* perf_event_paranoid up to 2 is fine) and counts the calling thread and the
+* threads it starts. When the PMU multiplexes, counts are scaled by
+* time_enabled / time_running. An event which can not be opened is left out of
+* the counters, a VM or container without a virtual PMU still gets page_faults,
+* a software event. The events which are missing are listed once on stderr.
+* Google Benchmark has --benchmark_perf_counters too, but only when it is
+* built with libpfm, which the usual packages are not.
+* Linux only.
+******/
+#ifndef BENCHMARK_PERFCOUNTERS_H
+#define BENCHMARK_PERFCOUNTERS_H
+
+#include<atomic>
+#include<cerrno>
+#include<cstdint>
+#include<cstdio>
+#include<cstring>
+#include<string>
+#include<benchmark/benchmark.h>
+#include<linux/perf_event.h>
+#include<sys/ioctl.h>
+#include<sys/syscall.h>
+#include<unistd.h>
+
+struct perf_event_spec {
+    const char* name_;
+    std::uint32_t type_;
+    std::uint64_t config_;
+};
+
+constexpr static std::uint64_t perf_cache_miss(std::uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+constexpr static perf_event_spec PERF_EVENTS[] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"L1d_misses", PERF_TYPE_HW_CACHE, perf_cache_miss(PERF_COUNT_HW_CACHE_L1D)},
+    {"LLC_misses", PERF_TYPE_HW_CACHE, perf_cache_miss(PERF_COUNT_HW_CACHE_LL)},
+    {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"dTLB_misses", PERF_TYPE_HW_CACHE, perf_cache_miss(PERF_COUNT_HW_CACHE_DTLB)},
+    {"page_faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+};
+constexpr static std::size_t PERF_EVENT_COUNT = sizeof(PERF_EVENTS) / sizeof(PERF_EVENTS[0]);
+
+class perf_counters {
+    int fd_[PERF_EVENT_COUNT];
+    double total_[PERF_EVENT_COUNT];
+
+    static int open_event(const perf_event_spec& e) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = e.type_;
+        attr.config = e.config_;
+        attr.disabled = 1;
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return int(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+    void ioctl_all(unsigned long request) {
+        for(std::size_t i = 0; i < PERF_EVENT_COUNT; ++i)
+            if(fd_[i] >= 0)
+                ::ioctl(fd_[i], request, 0);
+    }
+public:
+    perf_counters() {
+        std::string missing;
+        for(std::size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+            fd_[i] = open_event(PERF_EVENTS[i]);
+            total_[i] = 0;
+            if(fd_[i] < 0)
+                missing += std::string(missing.empty() ? "" : ", ") + PERF_EVENTS[i].name_
+                    + " (" + std::strerror(errno) + ")";
+        }
+        /*benchmark threads construct their counters concurrently*/
+        static std::atomic<bool> reported(false);
+        if(!missing.empty() && !reported.exchange(true))
+            std::fprintf(stderr, "perf counters not available: %s\n", missing.c_str());
+    }
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+    ~perf_counters() {
+        for(std::size_t i = 0; i < PERF_EVENT_COUNT; ++i)
+            if(fd_[i] >= 0)
+                ::close(fd_[i]);
+    }
+
+    bool available(std::size_t event) const { return fd_[event] >= 0; }
+    void start() {
+        for(std::size_t i = 0; i < PERF_EVENT_COUNT; ++i)
+            total_[i] = 0;
+        ioctl_all(PERF_EVENT_IOC_RESET);
+        ioctl_all(PERF_EVENT_IOC_ENABLE);
+    }
+    void pause() { ioctl_all(PERF_EVENT_IOC_DISABLE); }
+    void resume() { ioctl_all(PERF_EVENT_IOC_ENABLE); }
+    void stop(benchmark::State& state) {
+        pause();
+        for(std::size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+            std::uint64_t v[3];  // value, time enabled, time running
+            if(fd_[i] < 0 || ::read(fd_[i], v, sizeof(v)) != ssize_t(sizeof(v)))
+                continue;
+            total_[i] = v[2] ? double(v[0]) * v[1] / v[2] : 0;
+            state.counters[PERF_EVENTS[i].name_] = benchmark::Counter(total_[i], benchmark::Counter::kAvgIterations);
+        }
+        /*cycles and instructions are the first two events. The counters of all
+          threads of a benchmark are summed, a ratio has to be averaged.*/
+        if(available(0) && available(1) && total_[0] > 0)
+            state.counters["IPC"] = benchmark::Counter(total_[1] / total_[0], benchmark::Counter::kAvgThreads);
+    }
+};
+
+#endif
@@ -0,0 +1,148 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* Where does the time of a traversal go? An opt in profile of the profiled copies
+* of the DFA functions (DFA_recursive_profiled and DFA_iterative_profiled in
+* RecursionIteration_DFA.h) and of the counting loops in RecursionIteration_1.cpp.
+* Build with -DTRAVERSAL_PROFILE to turn it on:
+*     traversal_profile& profile = this_thread_profile();
+*     profile.start();
+*     for(auto _ : state) {
+*         DFA_iterative_profiled(G, 0, store, result);
+*         profile.enter(PHASE_OTHER);
+*     }
+*     profile.stop(state);
+* The instrumented code calls enter(phase) whenever it moves from one kind of
+* work to another. enter() reads the time stamp counter once and charges the
+* ticks since the previous enter() to the phase which was running, so every tick
+* between start() and stop() lands in exactly one phase and nested calls (the
+* recursive DFA) are not counted twice. The cost of reading the counter is
+* measured once and taken off every interval. Ticks are rdtsc reference cycles
+* (nominal frequency, not the core clock), steady_clock nanoseconds on other
+* architectures.
+* stop() adds, per iteration, <phase>_cycles for every phase which was used,
+* nodes (nodes visited), edges (edges scanned, children pushed), duplicates
+* (pops or calls for a node already visited) and max_depth, the highest stack
+* size (entries for the explicit stacks, frames for the recursion).
+* Even calibrated, a counter read every few instructions changes the code it
+* measures: compare the phases with each other, the total time comes from the
+* normal build.
+* Without TRAVERSAL_PROFILE every member is an empty inline function and no
+* counter is added. The measured traversals are never instrumented, only their
+* *_profiled copies call the profile.
+******/
+#ifndef BENCHMARK_TRAVERSALPROFILE_H
+#define BENCHMARK_TRAVERSALPROFILE_H
+
+#include<cstddef>
+#include<cstdint>
+#include <benchmark/benchmark.h>
+#ifdef TRAVERSAL_PROFILE
+#include<algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include<x86intrin.h>
+#else
+#include<chrono>
+#endif
+#endif
+
+enum profile_phase {
+    PHASE_VISITED,    // visited store test and set
+    PHASE_STACK,      // push, pop, call and return
+    PHASE_ADJACENCY,  // reading the neighbours
+    PHASE_WORK,       // the per node work of the counting recursion
+    PHASE_OTHER,      // everything outside of the traversal
+    PHASE_COUNT
+};
+
+#ifdef TRAVERSAL_PROFILE
+constexpr static const char* PROFILE_PHASE_NAMES[PHASE_COUNT] = {
+    "visited_cycles", "stack_cycles", "adjacency_cycles", "work_cycles", "other_cycles"
+};
+
+class traversal_profile {
+    std::uint64_t cycles_[PHASE_COUNT];
+    std::uint64_t last_ = 0;
+    std::uint64_t overhead_ = 0;
+    profile_phase phase_ = PHASE_OTHER;
+    std::uint64_t nodes_ = 0;
+    std::uint64_t edges_ = 0;
+    std::uint64_t duplicates_ = 0;
+    std::size_t depth_ = 0;
+    std::size_t max_depth_ = 0;
+
+    static std::uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+public:
+    traversal_profile() {
+        overhead_ = ~std::uint64_t(0);
+        for(int i = 0; i < 1000; ++i) {
+            const std::uint64_t a = ticks();
+            overhead_ = std::min(overhead_, ticks() - a);
+        }
+        start();
+    }
+    void start() {
+        for(auto& c : cycles_)
+            c = 0;
+        nodes_ = edges_ = duplicates_ = 0;
+        depth_ = max_depth_ = 0;
+        phase_ = PHASE_OTHER;
+        last_ = ticks();
+    }
+    void enter(profile_phase phase) {
+        const std::uint64_t now = ticks();
+        const std::uint64_t elapsed = now - last_;
+        cycles_[phase_] += elapsed > overhead_ ? elapsed - overhead_ : 0;
+        phase_ = phase;
+        last_ = now;
+    }
+    void visit() { ++nodes_; }
+    void duplicate() { ++duplicates_; }
+    void edge(std::size_t depth) {
+        ++edges_;
+        max_depth_ = std::max(max_depth_, depth);
+    }
+    std::size_t descend() { return ++depth_; }
+    void ascend() { --depth_; }
+    void stop(benchmark::State& state) {
+        enter(PHASE_OTHER);
+        for(int p = 0; p < PHASE_COUNT; ++p)
+            if(cycles_[p])
+                state.counters[PROFILE_PHASE_NAMES[p]] = benchmark::Counter(double(cycles_[p]),
+                                                                            benchmark::Counter::kAvgIterations);
+        state.counters["nodes"] = benchmark::Counter(double(nodes_), benchmark::Counter::kAvgIterations);
+        state.counters["edges"] = benchmark::Counter(double(edges_), benchmark::Counter::kAvgIterations);
+        state.counters["duplicates"] = benchmark::Counter(double(duplicates_), benchmark::Counter::kAvgIterations);
+        state.counters["max_depth"] = benchmark::Counter(double(max_depth_), benchmark::Counter::kAvgThreads);
+    }
+};
+#else
+class traversal_profile {
+public:
+    void start() {}
+    void enter(profile_phase) {}
+    void visit() {}
+    void duplicate() {}
+    void edge(std::size_t) {}
+    std::size_t descend() { return 0; }
+    void ascend() {}
+    void stop(benchmark::State&) {}
+};
+#endif
+
+inline traversal_profile& this_thread_profile() {
+    static thread_local traversal_profile profile;
+    return profile;
+}
+
+#endif
@@ -0,0 +1,216 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+* 18th Oct, 2026
+*
+* Connected component labels (edge direction ignored) for the whole graph.
+*   BM_components_dfs        : the serial baseline, DFA_iterative from every node
+*                              not labelled yet, over the undirected form of the
+*                              graph (every edge in both directions). The visited
+*                              store is the label array itself: set() writes the
+*                              current component, so no extra pass is needed.
+*   BM_components_union_find : union_find_components of Graph_Components.h on the
+*                              directed graph, every edge is seen once.
+*   BM_components_afforest   : afforest_components, out and in CSR.
+* range(3) is the number of threads. All three give the smallest node id of the
+* component as label, the parallel ones are checked against the baseline.
+* BM_components_tables runs union_find_components on the 100 node tables of
+* RecursionIteration_DFA_2.cpp, whose header says they are fully connected.
+******/
+
+#include<cstdint>
+#include<set>
+#include<vector>
+#include <benchmark/benchmark.h>
+#include "RecursionIteration_DFA.h"
+#include "Graph_CSR.h"
+#include "Graph_Generator.h"
+#include "Graph_Components.h"
+
+/*Visited store which labels: a node is visited once it has a label.*/
+template<typename Index>
+struct component_store {
+    constexpr static Index NONE = Index(~Index(0));
+    std::vector<Index>& label_;
+    Index current_ = 0;
+    bool test(std::size_t node) const { return label_[node] != Index(NONE); }
+    void set(std::size_t node) { label_[node] = current_; }
+};
+
+template<typename Index>
+std::size_t dfs_components(const CSRGraph<Index>& undirected, std::vector<Index>& label) {
+    label.assign(undirected.node_count(), Index(component_store<Index>::NONE));
+    component_store<Index> store{ label };
+    std::size_t components = 0;
+    for(std::size_t v = 0; v < undirected.node_count(); ++v) {
+        if(store.test(v))
+            continue;
+        store.current_ = Index(v);
+        int result = 0;
+        DFA_iterative(undirected, Index(v), store, result);
+        ++components;
+    }
+    return components;
+}
+
+struct component_inputs {
+    CSRGraph32 out_;
+    CSRGraph32 in_;
+    CSRGraph32 undirected_;
+};
+/*range(0) GraphTopology, range(1) nodes, range(2) average degree.*/
+static component_inputs make_inputs(benchmark::State& state) {
+    std::size_t nodes;
+    auto edges = generate_graph<std::uint32_t>(static_cast<GraphTopology>(state.range(0)),
+                                               state.range(1), state.range(2), 1, &nodes);
+    component_inputs c;
+    c.out_ = make_csr<std::uint32_t>(edges, nodes);
+    c.in_ = transpose(c.out_);
+    const std::size_t m = edges.size();
+    edges.reserve(2 * m);
+    for(std::size_t i = 0; i < m; ++i)
+        edges.push_back({ edges[i].second, edges[i].first });
+    c.undirected_ = make_csr<std::uint32_t>(edges, nodes);
+    return c;
+}
+
+static void BM_components_dfs(benchmark::State& state) {
+    const auto c = make_inputs(state);
+    std::vector<std::uint32_t> label;
+    std::size_t components = 0;
+    for(auto _ : state) {
+        components = dfs_components(c.undirected_, label);
+        benchmark::DoNotOptimize(components);
+    }
+    state.counters["components"] = components;
+}
+static void BM_components_union_find(benchmark::State& state) {
+    const auto c = make_inputs(state);
+    std::vector<std::uint32_t> label, expected;
+    std::size_t components = 0;
+    for(auto _ : state) {
+        components = union_find_components<std::uint32_t>(c.out_, c.out_.node_count(), label,
+                                                          unsigned(state.range(3)));
+        benchmark::DoNotOptimize(components);
+    }
+    dfs_components(c.undirected_, expected);
+    if(label != expected)
+        state.SkipWithError("union find labels differ from the DFS labels");
+    state.counters["components"] = components;
+}
+static void BM_components_afforest(benchmark::State& state) {
+    const auto c = make_inputs(state);
+    std::vector<std::uint32_t> label, expected;
+    std::size_t components = 0;
+    for(auto _ : state) {
+        components = afforest_components(c.out_, c.in_, c.out_.node_count(), label,
+                                         unsigned(state.range(3)));
+        benchmark::DoNotOptimize(components);
+    }
+    dfs_components(c.undirected_, expected);
+    if(label != expected)
+        state.SkipWithError("afforest labels differ from the DFS labels");
+    state.counters["components"] = components;
+}
+static void BM_components_tables(benchmark::State& state) {
+    Graph G(state.range(0));
+    std::vector<int> label;
+    std::size_t components = 0;
+    for(auto _ : state) {
+        components = union_find_components<int>(G, G.node_count, label, 1);
+        benchmark::DoNotOptimize(components);
+    }
+    /*checked once, outside of the timed loop: one weak component, and every
+      node reachable from 0 along the directed edges as the DFA benchmarks assume*/
+    std::set<int> visited;
+    int reached = 0;
+    DFA_iterative(G, 0, visited, reached);
+    if(components != 1)
+        state.SkipWithError("the tables are not a single component");
+    else if(reached != G.node_count)
+        state.SkipWithError("not every node is reachable from node 0");
+    state.counters["components"] = components;
+    state.counters["reached"] = reached;
+}
+
+static void component_graphs(benchmark::internal::Benchmark* b) {
+    for(long threads : {1, 4}) {
+        b->Args({ERDOS_RENYI, 1 << 22, 1, threads});
+        b->Args({ERDOS_RENYI, 1 << 22, 8, threads});
+        b->Args({RMAT, 1 << 22, 8, threads});
+        b->Args({GRID, 1 << 22, 4, threads});
+    }
+}
+
+BENCHMARK(BM_components_dfs)
+    ->Args({ERDOS_RENYI, 1 << 22, 1, 1})
+    ->Args({ERDOS_RENYI, 1 << 22, 8, 1})
+    ->Args({RMAT, 1 << 22, 8, 1})
+    ->Args({GRID, 1 << 22, 4, 1})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_components_union_find)
+    ->Apply(component_graphs)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_components_afforest)
+    ->Apply(component_graphs)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_components_tables)
+    ->Arg(10)->Arg(20)->Arg(30)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_MAIN();
+
+/******
+* Linux x86_64, KVM guest, Intel Xeon (Sapphire Rapids)
+* Run on (1 X 2000 MHz CPU )
+* CPU Caches:
+*   L1 Data 48 KiB (x1)
+*   L2 Unified 2048 KiB (x1)
+*   L3 Unified 107520 KiB (x1)
+* g++ (12.2) GraphTraversal_Components_8.cpp -pthread -std=c++14 -lbenchmark -O3
+* Args are topology (0 ER, 1 R-MAT, 3 grid) / nodes / average degree / threads.
+* BM_components_dfs/0/4194304/1/1                        1376 ms   components=679.612k
+* BM_components_dfs/0/4194304/8/1                        4702 ms   components=1
+* BM_components_dfs/1/4194304/8/1                        2710 ms   components=2.18671M
+* BM_components_dfs/3/4194304/4/1                         156 ms   components=1
+* BM_components_union_find/0/4194304/1/1/real_time        534 ms   components=679.612k
+* BM_components_union_find/0/4194304/8/1/real_time       1265 ms   components=1
+* BM_components_union_find/1/4194304/8/1/real_time       1022 ms   components=2.18671M
+* BM_components_union_find/3/4194304/4/1/real_time        123 ms   components=1
+* BM_components_union_find/0/4194304/1/4/real_time        571 ms   components=679.612k
+* BM_components_union_find/0/4194304/8/4/real_time        977 ms   components=1
+* BM_components_union_find/1/4194304/8/4/real_time        865 ms   components=2.18671M
+* BM_components_union_find/3/4194304/4/4/real_time        104 ms   components=1
+* BM_components_afforest/0/4194304/1/1/real_time          655 ms   components=679.612k
+* BM_components_afforest/0/4194304/8/1/real_time          710 ms   components=1
+* BM_components_afforest/1/4194304/8/1/real_time          643 ms   components=2.18671M
+* BM_components_afforest/3/4194304/4/1/real_time          158 ms   components=1
+* BM_components_afforest/0/4194304/1/4/real_time          887 ms   components=679.612k
+* BM_components_afforest/0/4194304/8/4/real_time          825 ms   components=1
+* BM_components_afforest/1/4194304/8/4/real_time          652 ms   components=2.18671M
+* BM_components_afforest/3/4194304/4/4/real_time          214 ms   components=1
+* BM_components_tables/10                                7.34 us   components=1 reached=100
+* BM_components_tables/20                                12.6 us   components=1 reached=100
+* BM_components_tables/30                                13.9 us   components=1 reached=100
+*
+* Observations :
+* 1) Even on one thread union find is 1.3 - 3.8x faster than the DFS baseline.
+*    It reads every edge once from the directed graph, the DFS needs the
+*    undirected form (twice the edges) and a stack push per edge.
+* 2) Afforest wins where there is a giant component: dense ER in 710 ms against
+*    1265 for plain union find and 4702 for DFS, 6.6x. After two neighbour
+*    rounds almost every node is in the giant component and is skipped with all
+*    its edges. With many small components (ER degree 1) nothing is skipped and
+*    the sampling rounds are pure overhead, there plain union find is better.
+* 3) This machine has a single core, the 4 thread rows only show that the
+*    contention of the lock free unite/find costs little (and on the grid and
+*    dense ER the extra threads even hide some memory latency). The scaling
+*    itself has to be measured on a multi core host.
+* 4) The 100 node tables are a single component for 10, 20 and 30 neighbours,
+*    and DFA_iterative from node 0 reaches all 100 nodes along the directed
+*    edges, as RecursionIteration_DFA_2.cpp says. BM_components_tables checks
+*    both after its timed loop and fails with an error otherwise.
+******/
@@ -0,0 +1,183 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+* 18th Oct, 2026
+*
+* Memory and traversal speed of three forms of the same graph:
+*   BM_DFA_nonrecursive_graph      : Graph, std::vector<std::vector<int>> lists.
+*   BM_DFA_nonrecursive_csr        : CSRGraph32 (Graph_CSR.h).
+*   BM_DFA_nonrecursive_compressed : CompressedGraph (Graph_Compressed.h), sorted
+*                                    lists of group varint gaps decoded on the fly.
+* The same DFA_iterative runs over all three, the compressed neighbour range
+* decodes as it is iterated. bytes_per_edge counts all the memory of the form, for
+* Graph the 24 byte vector header per node, the capacity of every list and 16
+* bytes of malloc overhead per non empty list.
+* Gaps are only small if neighbour ids are close, so R-MAT is also run after the
+* RCM relabelling of Graph_Reorder.h, and ER with a high degree (small gaps) is added.
+******/
+
+#include<algorithm>
+#include<cstdint>
+#include<vector>
+#include <benchmark/benchmark.h>
+#include "RecursionIteration_DFA.h"
+#include "Graph_CSR.h"
+#include "Graph_VisitedSet.h"
+#include "Graph_Generator.h"
+#include "Graph_Reorder.h"
+#include "Graph_Compressed.h"
+
+/*range(0) GraphTopology, range(1) nodes, range(2) average degree, range(3) ReorderKind.*/
+static CSRGraph32 input_graph(benchmark::State& state, std::uint32_t* root) {
+    std::size_t nodes;
+    auto edges = generate_graph<std::uint32_t>(static_cast<GraphTopology>(state.range(0)),
+                                               state.range(1), state.range(2), 1, &nodes);
+    *root = edges[0].first;
+    auto G = make_csr<std::uint32_t>(edges, nodes);
+    EdgeList<std::uint32_t>().swap(edges);
+    const auto order = reorder(G, static_cast<ReorderKind>(state.range(3)), *root);
+    *root = order.new_id_[*root];
+    return relabel(G, order);
+}
+
+/*Edges followed by a traversal from root, ie. the out degrees of every
+  visited node, and the counters every benchmark reports. g is a form of C, the
+  node and edge counts and the degrees are taken from C.*/
+template<typename G>
+static void report(benchmark::State& state, const G& g, const CSRGraph32& C,
+                   std::uint32_t root, std::size_t bytes) {
+    bitmap_visited store(C.node_count());
+    int result = 0;
+    DFA_iterative(g, typename G::node_type(root), store, result);
+    std::size_t edges = 0;
+    for(std::size_t v = 0; v < C.node_count(); ++v)
+        if(store.test(v))
+            edges += C.neighbors(std::uint32_t(v)).size();
+    state.counters["edges_per_second"] = benchmark::Counter(
+        double(edges) * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["bytes_per_edge"] = double(bytes) / C.edge_count();
+    state.counters["visited"] = result;
+}
+
+template<typename G>
+static int traverse(benchmark::State& state, const G& g, std::size_t node_count, std::uint32_t root) {
+    bitmap_visited store(node_count);
+    int result = 0;
+    for(auto _ : state) {
+        result = 0;
+        store.reset();
+        DFA_iterative(g, typename G::node_type(root), store, result);
+        benchmark::DoNotOptimize(result);
+    }
+    return result;
+}
+
+static void BM_DFA_nonrecursive_graph(benchmark::State& state) {
+    std::uint32_t root;
+    const auto C = input_graph(state, &root);
+    Graph g(int(C.node_count()), 0, 1);
+    std::size_t bytes = sizeof(std::vector<int>) * C.node_count();
+    for(std::size_t u = 0; u < C.node_count(); ++u) {
+        for(auto v : C.neighbors(std::uint32_t(u)))
+            g.adjecency_list_[u].push_back(int(v));
+        bytes += g.adjecency_list_[u].capacity() * sizeof(int) + (g.adjecency_list_[u].empty() ? 0 : 16);
+    }
+    traverse(state, g, C.node_count(), root);
+    report(state, g, C, root, bytes);
+}
+static void BM_DFA_nonrecursive_csr(benchmark::State& state) {
+    std::uint32_t root;
+    const auto C = input_graph(state, &root);
+    traverse(state, C, C.node_count(), root);
+    report(state, C, C, root, (C.offsets_.size() + C.neighbors_.size()) * sizeof(std::uint32_t));
+}
+static void BM_DFA_nonrecursive_compressed(benchmark::State& state) {
+    std::uint32_t root;
+    const auto C = input_graph(state, &root);
+    const CompressedGraph<std::uint32_t> Z(C);
+    /*sorted lists are the same set of neighbours, but in another order, so check the
+      decode by comparing the neighbour sets node by node*/
+    std::vector<std::uint32_t> a, b;
+    for(std::size_t u = 0; u < C.node_count(); ++u) {
+        auto r = C.neighbors(std::uint32_t(u));
+        a.assign(r.begin(), r.end());
+        std::sort(a.begin(), a.end());
+        b.clear();
+        for(auto v : Z.neighbors(std::uint32_t(u)))
+            b.push_back(v);
+        if(a != b) {
+            state.SkipWithError("compressed lists do not decode to the original ones");
+            return;
+        }
+    }
+    traverse(state, Z, C.node_count(), root);
+    report(state, Z, C, root, Z.bytes());
+}
+
+static void compressed_inputs(benchmark::internal::Benchmark* b) {
+    b->Args({ERDOS_RENYI, 1 << 20, 8, ORIGINAL});
+    b->Args({RMAT, 1 << 20, 8, ORIGINAL});
+    b->Args({RMAT, 1 << 20, 8, RCM_ORDER});
+    b->Args({GRID, 1 << 20, 4, ORIGINAL});
+    b->Args({ERDOS_RENYI, 1 << 16, 64, ORIGINAL});
+}
+
+BENCHMARK(BM_DFA_nonrecursive_graph)
+    ->Apply(compressed_inputs)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DFA_nonrecursive_csr)
+    ->Apply(compressed_inputs)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DFA_nonrecursive_compressed)
+    ->Apply(compressed_inputs)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
+
+/******
+* Linux x86_64, KVM guest, Intel Xeon (Sapphire Rapids)
+* Run on (1 X 2000 MHz CPU )
+* CPU Caches:
+*   L1 Data 48 KiB (x1)
+*   L2 Unified 2048 KiB (x1)
+*   L3 Unified 107520 KiB (x1)
+* g++ (12.2) GraphTraversal_Compressed_6.cpp -pthread -std=c++14 -lbenchmark -O3
+* Args are topology (0 ER, 1 R-MAT, 3 grid) / nodes / average degree / order (0 original, 2 RCM).
+* BM_DFA_nonrecursive_graph/0/1048576/8/0         516 ms   bytes_per_edge=10.4441 edges_per_second=16.2465M/s
+* BM_DFA_nonrecursive_graph/1/1048576/8/0         229 ms   bytes_per_edge=9.56854 edges_per_second=36.0011M/s
+* BM_DFA_nonrecursive_graph/1/1048576/8/2         154 ms   bytes_per_edge=9.56854 edges_per_second=53.493M/s
+* BM_DFA_nonrecursive_graph/3/1048576/4/0        22.1 ms   bytes_per_edge=14.0137 edges_per_second=189.624M/s
+* BM_DFA_nonrecursive_graph/0/65536/64/0         34.7 ms   bytes_per_edge=6.48456 edges_per_second=120.865M/s
+* BM_DFA_nonrecursive_csr/0/1048576/8/0           402 ms   bytes_per_edge=4.5     edges_per_second=20.8631M/s
+* BM_DFA_nonrecursive_csr/1/1048576/8/0           193 ms   bytes_per_edge=4.5     edges_per_second=42.7425M/s
+* BM_DFA_nonrecursive_csr/1/1048576/8/2           120 ms   bytes_per_edge=4.5     edges_per_second=68.6862M/s
+* BM_DFA_nonrecursive_csr/3/1048576/4/0          18.8 ms   bytes_per_edge=5.00098 edges_per_second=222.814M/s
+* BM_DFA_nonrecursive_csr/0/65536/64/0           27.2 ms   bytes_per_edge=4.0625  edges_per_second=154.421M/s
+* BM_DFA_nonrecursive_compressed/0/1048576/8/0    530 ms   bytes_per_edge=4.21824 edges_per_second=15.8286M/s
+* BM_DFA_nonrecursive_compressed/1/1048576/8/0    270 ms   bytes_per_edge=3.51399 edges_per_second=30.5253M/s
+* BM_DFA_nonrecursive_compressed/1/1048576/8/2    205 ms   bytes_per_edge=3.12508 edges_per_second=40.2638M/s
+* BM_DFA_nonrecursive_compressed/3/1048576/4/0   40.4 ms   bytes_per_edge=4.25343 edges_per_second=103.838M/s
+* BM_DFA_nonrecursive_compressed/0/65536/64/0    38.4 ms   bytes_per_edge=2.20721 edges_per_second=109.319M/s
+* Same compressed runs with -mavx2 (pshufb group decode)
+* BM_DFA_nonrecursive_compressed/0/1048576/8/0    494 ms   bytes_per_edge=4.21824 edges_per_second=16.9845M/s
+* BM_DFA_nonrecursive_compressed/1/1048576/8/0    251 ms   bytes_per_edge=3.51399 edges_per_second=32.8271M/s
+* BM_DFA_nonrecursive_compressed/1/1048576/8/2    169 ms   bytes_per_edge=3.12508 edges_per_second=48.7798M/s
+* BM_DFA_nonrecursive_compressed/3/1048576/4/0   34.1 ms   bytes_per_edge=4.25343 edges_per_second=122.929M/s
+* BM_DFA_nonrecursive_compressed/0/65536/64/0    31.2 ms   bytes_per_edge=2.20721 edges_per_second=134.462M/s
+*
+* Observations :
+* 1) Graph costs 10 - 14 bytes per edge at low degree, the vector header and the
+*    malloc overhead are paid per node. CSR halves it and is also the fastest.
+* 2) The compressed form is 2.5 - 3x smaller than Graph and up to 1.8x smaller
+*    than CSR. The gain grows with the degree (2.2 bytes per edge at degree 64)
+*    and with locality (RCM on R-MAT). At degree 4 - 8 a good part of what is
+*    left is the 8 byte offset and the degree byte per node, not the gaps.
+* 3) Decoding costs time whenever the traversal is not waiting on memory: the
+*    grid, whose lists are in cache order anyway, runs at half the CSR speed.
+*    On the random 1M node graph, where every node is a cache miss, it is within
+*    20% of CSR and as fast as Graph while being 2.5x smaller.
+* 4) The pshufb decode is 7 - 20% faster than the scalar loop. Most of the cost
+*    per group is in the iterator (group boundary check, table lookup), the 4
+*    lane prefix sum itself is cheap.
+******/
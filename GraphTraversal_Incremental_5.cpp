@@ -0,0 +1,158 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+* 18th Oct, 2026
+*
+* Keeping the set of nodes reachable from a root up to date while edges stream in.
+* The graph starts as the first eighth of a shuffled Erdos-Renyi edge list of
+* average degree 4 (degree 0.5, the root reaches almost nothing) and the rest of
+* the edges are inserted in batches of range(1). After every batch
+*   BM_full_reachability        runs DFA_iterative over the whole graph again.
+*   BM_incremental_reachability updates incremental_reachability (Graph_Incremental.h),
+*                               only nodes which became reachable are explored.
+* Building the starting graph is not timed, the initial traversal is.
+* Reported as inserts_per_second, both must end with the same reachable count.
+******/
+
+#include<algorithm>
+#include<cstdint>
+#include<random>
+#include<vector>
+#include <benchmark/benchmark.h>
+#include "RecursionIteration_DFA.h"
+#include "Graph_CSR.h"
+#include "Graph_VisitedSet.h"
+#include "Graph_Generator.h"
+#include "Graph_Incremental.h"
+
+constexpr static std::size_t STREAM_DEGREE = 4;
+
+struct edge_stream {
+    std::size_t nodes_;
+    EdgeList<std::uint32_t> initial_;
+    std::vector<EdgeList<std::uint32_t>> batches_;
+    std::uint32_t root_;
+};
+
+/*range(0) nodes, range(1) batch size.*/
+static edge_stream make_stream(benchmark::State& state) {
+    edge_stream s;
+    auto edges = generate_graph<std::uint32_t>(ERDOS_RENYI, state.range(0), STREAM_DEGREE, 1, &s.nodes_);
+    std::mt19937 gen(7);
+    std::shuffle(edges.begin(), edges.end(), gen);
+    const std::size_t initial = edges.size() / 8;
+    const std::size_t batch = state.range(1);
+    s.initial_.assign(edges.begin(), edges.begin() + initial);
+    for(std::size_t b = initial; b < edges.size(); b += batch)
+        s.batches_.emplace_back(edges.begin() + b, edges.begin() + std::min(b + batch, edges.size()));
+    s.root_ = edges[0].first;
+    return s;
+}
+
+static std::size_t stream_inserts(const edge_stream& s) {
+    std::size_t total = 0;
+    for(const auto& b : s.batches_)
+        total += b.size();
+    return total;
+}
+
+static void BM_full_reachability(benchmark::State& state) {
+    const edge_stream s = make_stream(state);
+    bitmap_visited store(s.nodes_);
+    int result = 0;
+    for(auto _ : state) {
+        state.PauseTiming();
+        dynamic_graph<std::uint32_t> G(s.initial_, s.nodes_);
+        state.ResumeTiming();
+        store.reset();
+        result = 0;
+        DFA_iterative(G, s.root_, store, result);
+        for(const auto& batch : s.batches_) {
+            for(const auto& e : batch)
+                G.add_edge(e.first, e.second);
+            store.reset();
+            result = 0;
+            DFA_iterative(G, s.root_, store, result);
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["inserts_per_second"] = benchmark::Counter(
+        double(stream_inserts(s)) * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["reachable"] = result;
+}
+static void BM_incremental_reachability(benchmark::State& state) {
+    const edge_stream s = make_stream(state);
+    std::size_t reachable = 0;
+    for(auto _ : state) {
+        state.PauseTiming();
+        dynamic_graph<std::uint32_t> G(s.initial_, s.nodes_);
+        state.ResumeTiming();
+        incremental_reachability<std::uint32_t> R(G, s.root_);
+        for(const auto& batch : s.batches_) {
+            if(batch.size() == 1)
+                R.insert(batch[0].first, batch[0].second);
+            else
+                R.insert(batch);
+        }
+        reachable = R.count();
+        benchmark::DoNotOptimize(reachable);
+    }
+    /*the final set against a traversal of the final graph*/
+    dynamic_graph<std::uint32_t> G(s.initial_, s.nodes_);
+    for(const auto& batch : s.batches_)
+        for(const auto& e : batch)
+            G.add_edge(e.first, e.second);
+    bitmap_visited store(s.nodes_);
+    int result = 0;
+    DFA_iterative(G, s.root_, store, result);
+    if(std::size_t(result) != reachable)
+        state.SkipWithError("incremental and full reachability disagree");
+    state.counters["inserts_per_second"] = benchmark::Counter(
+        double(stream_inserts(s)) * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["reachable"] = reachable;
+}
+
+BENCHMARK(BM_full_reachability)
+    ->ArgsProduct({{1 << 16, 1 << 18}, {4096, 65536}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_incremental_reachability)
+    ->ArgsProduct({{1 << 16, 1 << 18}, {1, 64, 4096, 65536}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
+
+/******
+* Linux x86_64, KVM guest, Intel Xeon (Sapphire Rapids)
+* Run on (1 X 2000 MHz CPU )
+* CPU Caches:
+*   L1 Data 48 KiB (x1)
+*   L2 Unified 2048 KiB (x1)
+*   L3 Unified 107520 KiB (x1)
+* g++ (12.2) GraphTraversal_Incremental_5.cpp -pthread -std=c++14 -lbenchmark -O3
+* Args are nodes / batch size. 229K (64K nodes) and 917K (256K nodes) inserts.
+* BM_full_reachability/65536/4096                 436 ms   inserts_per_second=525.719k/s
+* BM_full_reachability/262144/4096              11281 ms   inserts_per_second=81.3308k/s
+* BM_full_reachability/65536/65536               52.7 ms   inserts_per_second=4.35278M/s
+* BM_full_reachability/262144/65536               910 ms   inserts_per_second=1008.43k/s
+* BM_incremental_reachability/65536/1            32.1 ms   inserts_per_second=7.15612M/s
+* BM_incremental_reachability/262144/1            281 ms   inserts_per_second=3.26326M/s
+* BM_incremental_reachability/65536/64           24.3 ms   inserts_per_second=9.42653M/s
+* BM_incremental_reachability/262144/64           290 ms   inserts_per_second=3.16176M/s
+* BM_incremental_reachability/65536/4096         34.0 ms   inserts_per_second=6.74242M/s
+* BM_incremental_reachability/262144/4096         219 ms   inserts_per_second=4.18709M/s
+* BM_incremental_reachability/65536/65536        24.7 ms   inserts_per_second=9.30093M/s
+* BM_incremental_reachability/262144/65536        221 ms   inserts_per_second=4.1602M/s
+* All runs end with 64282 / 256837 reachable nodes.
+*
+* Observations :
+* 1) The full traversal pays O(V + E) per batch, so its throughput is proportional
+*    to the batch size and falls with the graph size: 50x slower than incremental
+*    for batches of 4096 at 256K nodes, still 4x for batches of 65536.
+* 2) The incremental cost does not depend on the batch size, even single edge
+*    inserts run at 3 - 7 M/s. The total exploration is one traversal of the final
+*    graph, what is left is appending the edge to its adjacency list, a cache miss
+*    per insert on the larger graph.
+* 3) Batching helps little here (within noise) since there is no per batch
+*    overhead to amortize. It does let one DFS cover all the edges of a batch.
+******/
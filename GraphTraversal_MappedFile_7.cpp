@@ -0,0 +1,227 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+* 18th Oct, 2026
+*
+* Time to first traversal: everything from having a graph on disk (or in the
+* source) to having run DFA_iterative over it once.
+*   BM_first_traversal_tables     : Graph(30) of RecursionIteration_DFA_2.cpp, 100
+*                                   initializer lists, and a traversal.
+*   BM_first_traversal_edge_list  : load_edge_list_binary (Graph_EdgeListIO.h),
+*                                   make_csr and a traversal, the best load path
+*                                   there was so far.
+*   BM_first_traversal_mapped     : MappedGraph::open (Graph_MappedFile.h) and a
+*                                   traversal over the mapped pages, range(0) holds
+*                                   the MappedGraphHint flags.
+* range(1) = 1 drops the file from the page cache before every iteration
+* (posix_fadvise DONTNEED, not timed), which is the process start after the
+* file was last read long ago. 0 is a restart with the file still cached.
+* The large graph is ER with 4M nodes and 32M edges, 144MB as a graph file. It
+* is written once for all benchmarks and the files are removed at exit.
+******/
+
+#include<cstdint>
+#include<cstdio>
+#include<cstdlib>
+#include<set>
+#include<string>
+#include <benchmark/benchmark.h>
+#include<fcntl.h>
+#include<unistd.h>
+#include "RecursionIteration_DFA.h"
+#include "Graph_CSR.h"
+#include "Graph_VisitedSet.h"
+#include "Graph_Generator.h"
+#include "Graph_EdgeListIO.h"
+#include "Graph_MappedFile.h"
+#include "Benchmark_PerfCounters.h"
+
+static const char* SMALL_GRAPH_PATH = "/tmp/shortperfs_graph30.graph";
+static const char* EDGES_BINARY_PATH = "/tmp/shortperfs_first_traversal.bin";
+static const char* GRAPH_FILE_PATH = "/tmp/shortperfs_first_traversal.graph";
+constexpr static std::size_t LARGE_NODES = 1 << 22;
+constexpr static std::size_t LARGE_EDGES = 8 * LARGE_NODES;
+
+static void drop_cache(const char* path) {
+    int fd = ::open(path, O_RDONLY);
+    if(fd >= 0) {
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+}
+
+static void remove_large_files() {
+    std::remove(EDGES_BINARY_PATH);
+    std::remove(GRAPH_FILE_PATH);
+}
+/*Writes both files for the first benchmark which needs them, the others reuse
+  them. They are removed at exit. root is the source of the first edge.*/
+static bool large_files(benchmark::State& state, std::uint32_t* root) {
+    static bool written = false;
+    static std::uint32_t first = 0;
+    if(!written) {
+        auto edges = erdos_renyi<std::uint32_t>(LARGE_NODES, LARGE_EDGES, 1);
+        std::atexit(remove_large_files);
+        written = write_edge_list_binary(EDGES_BINARY_PATH, edges)
+            && write_graph_file<std::uint32_t>(GRAPH_FILE_PATH, make_csr<std::uint32_t>(edges, LARGE_NODES), LARGE_NODES);
+        first = edges[0].first;
+    }
+    if(!written)
+        state.SkipWithError("can not write the graph files");
+    *root = first;
+    return written;
+}
+
+static void BM_first_traversal_tables(benchmark::State& state) {
+    int result = 0;
+    for(auto _ : state) {
+        Graph G(30);
+        std::set<int> visited;
+        result = 0;
+        DFA_iterative(G, 0, visited, result);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["visited"] = result;
+}
+static void BM_first_traversal_mapped_tables(benchmark::State& state) {
+    Graph G(30);
+    if(!write_graph_file<std::uint32_t>(SMALL_GRAPH_PATH, G, G.node_count)) {
+        state.SkipWithError("can not write the graph file");
+        return;
+    }
+    int result = 0;
+    for(auto _ : state) {
+        MappedGraph<std::uint32_t> M;
+        if(!M.open(SMALL_GRAPH_PATH)) {
+            state.SkipWithError("can not map the graph file");
+            break;
+        }
+        std::set<std::uint32_t> visited;
+        result = 0;
+        DFA_iterative(M, 0u, visited, result);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["visited"] = result;
+    std::remove(SMALL_GRAPH_PATH);
+}
+static void BM_first_traversal_edge_list(benchmark::State& state) {
+    std::uint32_t root;
+    if(!large_files(state, &root))
+        return;
+    int result = 0;
+    perf_counters perf;
+    perf.start();
+    for(auto _ : state) {
+        if(state.range(1)) {
+            state.PauseTiming();
+            perf.pause();
+            drop_cache(EDGES_BINARY_PATH);
+            perf.resume();
+            state.ResumeTiming();
+        }
+        EdgeList<std::uint32_t> edges;
+        if(!load_edge_list_binary(EDGES_BINARY_PATH, edges)) {
+            state.SkipWithError("can not load the edge list");
+            break;
+        }
+        const auto G = make_csr<std::uint32_t>(edges, edge_list_node_count(edges));
+        bitmap_visited store(G.node_count());
+        result = 0;
+        DFA_iterative(G, root, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+    perf.stop(state);
+    state.counters["visited"] = result;
+}
+static void BM_first_traversal_mapped(benchmark::State& state) {
+    std::uint32_t root;
+    if(!large_files(state, &root))
+        return;
+    int result = 0;
+    perf_counters perf;
+    perf.start();
+    for(auto _ : state) {
+        if(state.range(1)) {
+            state.PauseTiming();
+            perf.pause();
+            drop_cache(GRAPH_FILE_PATH);
+            perf.resume();
+            state.ResumeTiming();
+        }
+        MappedGraph<std::uint32_t> M;
+        if(!M.open(GRAPH_FILE_PATH, unsigned(state.range(0)))) {
+            state.SkipWithError("can not map the graph file");
+            break;
+        }
+        bitmap_visited store(M.node_count());
+        result = 0;
+        DFA_iterative(M, root, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+    perf.stop(state);
+    state.counters["visited"] = result;
+}
+
+BENCHMARK(BM_first_traversal_tables)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_first_traversal_mapped_tables)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_first_traversal_edge_list)
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_first_traversal_mapped)
+    ->ArgsProduct({{HINT_NONE, HINT_POPULATE, HINT_WILLNEED, HINT_RANDOM}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
+
+/******
+* Linux x86_64, KVM guest, Intel Xeon (Sapphire Rapids)
+* Run on (1 X 2000 MHz CPU )
+* CPU Caches:
+*   L1 Data 48 KiB (x1)
+*   L2 Unified 2048 KiB (x1)
+*   L3 Unified 107520 KiB (x1)
+* g++ (12.2) GraphTraversal_MappedFile_7.cpp -pthread -std=c++14 -lbenchmark -O3
+* Args are hint flags (0 none, 1 populate, 2 willneed, 4 random) / cold page cache.
+* BM_first_traversal_tables               207 us   visited=100
+* BM_first_traversal_mapped_tables        147 us   visited=100
+* BM_first_traversal_edge_list/0/0       4933 ms   visited=4.19293M
+* BM_first_traversal_edge_list/0/1       5080 ms   visited=4.19293M
+* BM_first_traversal_mapped/0/0          2481 ms   visited=4.19293M
+* BM_first_traversal_mapped/1/0          2369 ms   visited=4.19293M
+* BM_first_traversal_mapped/2/0          2429 ms   visited=4.19293M
+* BM_first_traversal_mapped/4/0          2572 ms   visited=4.19293M
+* BM_first_traversal_mapped/0/1          3076 ms   visited=4.19293M
+* BM_first_traversal_mapped/1/1          3007 ms   visited=4.19293M
+* BM_first_traversal_mapped/2/1          3154 ms   visited=4.19293M
+* BM_first_traversal_mapped/4/1          4205 ms   visited=4.19293M
+*
+* Observations :
+* 1) On the 32M edge graph the mapped file reaches the end of the first traversal
+*    1.6 - 2x sooner than loading the edge list and building the CSR. The mapped
+*    time is the validation of the offsets at open and the traversal, the load
+*    + counting sort (the 2 - 2.5 s difference) is simply gone, the file already
+*    is the CSR.
+* 2) MAP_POPULATE is the best hint when the whole graph is going to be touched
+*    anyway: one sequential read at open instead of a page fault per 4K (with
+*    read around) during the traversal. MADV_RANDOM is the worst on a cold
+*    cache, every fault reads a single page. It is meant for graphs larger than
+*    memory, not this case.
+* 3) The cold runs are 20 - 25% slower than the warm ones (random 65%). open()
+*    reads all 16MB of offsets before the traversal starts, so on a cold cache
+*    they are read once to be validated instead of as the traversal needs them.
+*    The guest's disk is backed by host memory, on a real disk the gap between
+*    populate and random would be much larger.
+* 4) For the 100 node tables the mapped file is only 30% faster, the std::set
+*    visited store of the traversal is most of the time at that size.
+* 5) page_faults per iteration (Benchmark_PerfCounters.h) show the hints at work:
+*    BM_first_traversal_edge_list/0/1       page_faults=98.307k
+*    BM_first_traversal_mapped/1/1          page_faults=0
+*    BM_first_traversal_mapped/4/1          page_faults=36.866k
+*    MAP_POPULATE takes no fault during the traversal, MADV_RANDOM takes one per
+*    page of the 144MB file (36.9K pages). The edge list path faults on the
+*    freshly allocated edge and CSR arrays instead.
+******/
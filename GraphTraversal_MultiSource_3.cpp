@@ -0,0 +1,255 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+* 18th Oct, 2026
+*
+* Reachability from many roots over the same graph. Running DFA_iterative once per
+* root reads the whole adjacency data once per root. MS-BFS (Then et al., "The More
+* the Merrier", VLDB 2015) runs a batch of 64*Words sources together: every node
+* carries a bitmask of the sources which have reached it (seen) and of the sources
+* for which it is in the current frontier (visit). One level is
+*     for every node v with visit[v] != 0
+*         for every neighbour n of v
+*             d = visit[v] & ~seen[n]
+*             if d != 0 : next[n] |= d, seen[n] |= d
+* so one pass over a node's neighbours advances every source of the batch.
+* With 256 sources the mask operations are single AVX2 instructions (-mavx2),
+* without it a loop over four 64 bit words.
+* Reported as sources_per_second against DFA_iterative per root.
+******/
+
+#include<algorithm>
+#include<cstdint>
+#include<vector>
+#include <benchmark/benchmark.h>
+#include "RecursionIteration_DFA.h"
+#include "Graph_CSR.h"
+#include "Graph_VisitedSet.h"
+#include "Graph_Generator.h"
+#ifdef __AVX2__
+#include<immintrin.h>
+#endif
+
+/*One bit per source of the batch. Unaligned loads are used for AVX2 as
+  std::vector does not honour over-alignment before C++17.*/
+template<unsigned Words>
+struct source_mask {
+    std::uint64_t w_[Words];
+
+    bool any() const {
+        std::uint64_t r = 0;
+        for(unsigned i = 0; i < Words; ++i)
+            r |= w_[i];
+        return r != 0;
+    }
+    void clear() {
+        for(unsigned i = 0; i < Words; ++i)
+            w_[i] = 0;
+    }
+    void set(unsigned bit) { w_[bit / 64] |= std::uint64_t(1) << (bit % 64); }
+    /*d = visit & ~seen; seen |= d; next |= d. Returns false when d is empty.*/
+    static bool advance(const source_mask& visit, source_mask& seen, source_mask& next) {
+        std::uint64_t any = 0;
+        for(unsigned i = 0; i < Words; ++i) {
+            std::uint64_t d = visit.w_[i] & ~seen.w_[i];
+            seen.w_[i] |= d;
+            next.w_[i] |= d;
+            any |= d;
+        }
+        return any != 0;
+    }
+};
+
+#ifdef __AVX2__
+template<>
+inline bool source_mask<4>::advance(const source_mask& visit, source_mask& seen, source_mask& next) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(visit.w_));
+    __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seen.w_));
+    __m256i d = _mm256_andnot_si256(s, v);
+    if(_mm256_testz_si256(d, d))
+        return false;
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(seen.w_), _mm256_or_si256(s, d));
+    __m256i n = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(next.w_));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(next.w_), _mm256_or_si256(n, d));
+    return true;
+}
+template<>
+inline bool source_mask<4>::any() const {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w_));
+    return !_mm256_testz_si256(v, v);
+}
+#endif
+
+/*Batched reachability, the three mask arrays are reused between runs.*/
+template<typename Index, unsigned Words>
+class multi_source_bfs {
+    const CSRGraph<Index>& G_;
+    std::vector<source_mask<Words>> seen_;
+    std::vector<source_mask<Words>> visit_;
+    std::vector<source_mask<Words>> next_;
+public:
+    constexpr static unsigned BATCH = 64 * Words;
+
+    explicit multi_source_bfs(const CSRGraph<Index>& G)
+        : G_(G), seen_(G.node_count()), visit_(G.node_count()), next_(G.node_count()) {}
+
+    /*Runs sources[0 .. min(BATCH, size)), afterwards bit i of seen(v) tells
+      whether sources[i] reaches v.*/
+    void run(const std::vector<Index>& sources) {
+        const std::size_t n = G_.node_count();
+        for(std::size_t v = 0; v < n; ++v) {
+            seen_[v].clear();
+            visit_[v].clear();
+            next_[v].clear();
+        }
+        const std::size_t batch = std::min<std::size_t>(BATCH, sources.size());
+        for(std::size_t i = 0; i < batch; ++i) {
+            seen_[sources[i]].set(i);
+            visit_[sources[i]].set(i);
+        }
+        bool active = batch != 0;
+        while(active) {
+            active = false;
+            for(std::size_t v = 0; v < n; ++v) {
+                const source_mask<Words>& visit = visit_[v];
+                if(!visit.any())
+                    continue;
+                for(auto u : G_.neighbors(Index(v)))
+                    active |= source_mask<Words>::advance(visit, seen_[u], next_[u]);
+            }
+            visit_.swap(next_);
+            for(auto& m : next_)
+                m.clear();
+        }
+    }
+    const source_mask<Words>& seen(Index v) const { return seen_[v]; }
+    /*Sum over the sources of the number of nodes each one reaches.*/
+    std::size_t reached_pairs() const {
+        std::size_t total = 0;
+        for(const auto& m : seen_)
+            for(unsigned i = 0; i < Words; ++i)
+                total += __builtin_popcountll(m.w_[i]);
+        return total;
+    }
+};
+
+constexpr static std::size_t GENERATED_DEGREE = 8;
+
+/*Distinct roots with at least one outgoing edge, in edge list order.*/
+static std::vector<std::uint32_t> pick_roots(const EdgeList<std::uint32_t>& edges,
+                                             std::size_t nodes, std::size_t count) {
+    std::vector<std::uint32_t> roots;
+    std::vector<char> taken(nodes, 0);
+    for(const auto& e : edges) {
+        if(roots.size() == count)
+            break;
+        if(!taken[e.first]) {
+            taken[e.first] = 1;
+            roots.push_back(e.first);
+        }
+    }
+    return roots;
+}
+
+/*range(0) GraphTopology, range(1) nodes, range(2) number of roots.*/
+static CSRGraph32 generated_csr(benchmark::State& state, std::vector<std::uint32_t>* roots) {
+    std::size_t nodes;
+    auto edges = generate_graph<std::uint32_t>(static_cast<GraphTopology>(state.range(0)),
+                                               state.range(1), GENERATED_DEGREE, 1, &nodes);
+    *roots = pick_roots(edges, nodes, state.range(2));
+    return make_csr<std::uint32_t>(edges, nodes);
+}
+
+static void BM_DFA_nonrecursive_per_root(benchmark::State& state) {
+    std::vector<std::uint32_t> roots;
+    auto G = generated_csr(state, &roots);
+    bitmap_visited store(G.node_count());
+    std::size_t pairs = 0;
+    for(auto _ : state) {
+        pairs = 0;
+        for(auto r : roots) {
+            int result = 0;
+            store.reset();
+            DFA_iterative(G, r, store, result);
+            pairs += result;
+        }
+        benchmark::DoNotOptimize(pairs);
+    }
+    state.counters["sources_per_second"] = benchmark::Counter(
+        double(roots.size()) * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["reached_pairs"] = pairs;
+}
+template<unsigned Words>
+static void BM_multi_source_bfs(benchmark::State& state) {
+    std::vector<std::uint32_t> roots;
+    auto G = generated_csr(state, &roots);
+    multi_source_bfs<std::uint32_t, Words> M(G);
+    for(auto _ : state) {
+        M.run(roots);
+        benchmark::ClobberMemory();
+    }
+    bitmap_visited store(G.node_count());
+    /*spot check the first roots against DFA_iterative*/
+    for(std::size_t i = 0; i < roots.size() && i < 8; ++i) {
+        int result = 0;
+        store.reset();
+        DFA_iterative(G, roots[i], store, result);
+        std::size_t reached = 0;
+        for(std::size_t v = 0; v < G.node_count(); ++v)
+            reached += (M.seen(std::uint32_t(v)).w_[i / 64] >> (i % 64)) & 1;
+        if(reached != std::size_t(result))
+            state.SkipWithError("MS-BFS and DFA_iterative disagree");
+    }
+    state.counters["sources_per_second"] = benchmark::Counter(
+        double(roots.size()) * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["reached_pairs"] = M.reached_pairs();
+}
+
+BENCHMARK(BM_DFA_nonrecursive_per_root)
+    ->ArgsProduct({{ERDOS_RENYI, RMAT}, {1 << 16, 1 << 18}, {64}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_multi_source_bfs, 1)
+    ->ArgsProduct({{ERDOS_RENYI, RMAT}, {1 << 16, 1 << 18}, {64}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_multi_source_bfs, 4)
+    ->ArgsProduct({{ERDOS_RENYI, RMAT}, {1 << 16, 1 << 18}, {256}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
+
+/******
+* Linux x86_64, KVM guest, Intel Xeon (Sapphire Rapids)
+* Run on (1 X 2000 MHz CPU )
+* CPU Caches:
+*   L1 Data 48 KiB (x1)
+*   L2 Unified 2048 KiB (x1)
+*   L3 Unified 107520 KiB (x1)
+* g++ (12.2) GraphTraversal_MultiSource_3.cpp -pthread -std=c++14 -lbenchmark -O3 -mavx2
+* Args are topology (0 ER, 1 R-MAT) / nodes / sources, average degree 8.
+* BM_DFA_nonrecursive_per_root/0/65536/64         412 ms   sources_per_second=157.482/s
+* BM_DFA_nonrecursive_per_root/1/65536/64         319 ms   sources_per_second=200.745/s
+* BM_DFA_nonrecursive_per_root/0/262144/64       5415 ms   sources_per_second=12.022/s
+* BM_DFA_nonrecursive_per_root/1/262144/64       2302 ms   sources_per_second=28.1027/s
+* BM_multi_source_bfs<1>/0/65536/64              14.0 ms   sources_per_second=4.84629k/s
+* BM_multi_source_bfs<1>/1/65536/64              11.0 ms   sources_per_second=5.9417k/s
+* BM_multi_source_bfs<1>/0/262144/64              119 ms   sources_per_second=546.857/s
+* BM_multi_source_bfs<1>/1/262144/64             75.1 ms   sources_per_second=866.542/s
+* BM_multi_source_bfs<4>/0/65536/256             38.4 ms   sources_per_second=6.74048k/s
+* BM_multi_source_bfs<4>/1/65536/256             27.0 ms   sources_per_second=9.63799k/s
+* BM_multi_source_bfs<4>/0/262144/256             288 ms   sources_per_second=900.169/s
+* BM_multi_source_bfs<4>/1/262144/256             157 ms   sources_per_second=1.63751k/s
+* Same <4> without -mavx2 (loop over 4 words)
+* BM_multi_source_bfs<4>/0/262144/256             679 ms   sources_per_second=411.207/s
+* BM_multi_source_bfs<4>/1/262144/256             347 ms   sources_per_second=741.229/s
+*
+* Observations :
+* 1) Batching 64 sources gives 30 - 45 times the sources per second of one
+*    DFA_iterative per root. The adjacency data is read once per level for the
+*    whole batch instead of once per root, and the visited "store" becomes part
+*    of the per node masks which are read sequentially.
+* 2) 256 sources per batch adds another 1.5 - 2x on top, but only with AVX2. The
+*    scalar 4 word loop is barely better than the 64 source batch.
+* 3) The per root DFA degrades faster with size (12/s at 256K nodes) because every
+*    root pays the full cache miss bill again, MS-BFS amortizes it.
+******/
@@ -0,0 +1,387 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+* 18th Oct, 2026
+*
+* DFA_iterative and DFA_recursive (RecursionIteration_DFA.h) answer "which nodes
+* are reachable from the root" on one core. Here the same question is answered
+* with all threads, to see how far that scales against the serial traversals.
+*
+* The order of the visit does not matter for reachability, so the parallel version
+* is a level synchronous BFS:
+* 1) Nodes are claimed with an atomic test-and-set on a shared visited bitmap, so
+*    every node is expanded by exactly one thread.
+* 2) Every thread appends the nodes it claims to its own next frontier, there is
+*    no shared queue. When processing a level a thread takes chunks of its own
+*    frontier first and then steals chunks from the other threads' frontiers.
+* 3) Direction optimization (Beamer et al.): when the frontier has more outgoing
+*    edges than the unexplored part of the graph / ALPHA, the level is run bottom
+*    up instead: every unvisited node scans its in-edges for a frontier node and
+*    stops at the first hit. It goes back to top down once the frontier is smaller
+*    than node_count / BETA.
+*    The bottom up step needs the frontier as a bitmap. It is built (every thread
+*    sets the bits of its own frontier part) only at the start of a bottom up
+*    level and cleared after it, top down levels never touch it. So a high
+*    diameter graph with thousands of small top down levels does not pay an
+*    O(node_count) clear per level.
+* 4) The threads are started once, with the parallel_reachability object, and
+*    wait on a barrier between two queries. run() only releases them, the timed
+*    loop does not measure thread creation.
+******/
+
+#include<algorithm>
+#include<atomic>
+#include<condition_variable>
+#include<cstdint>
+#include<mutex>
+#include<thread>
+#include<vector>
+#include <benchmark/benchmark.h>
+#include "RecursionIteration_DFA.h"
+#include "Graph_CSR.h"
+#include "Graph_VisitedSet.h"
+#include "Graph_Generator.h"
+
+constexpr static std::size_t FRONTIER_CHUNK = 256;
+constexpr static std::size_t ALPHA = 14;
+constexpr static std::size_t BETA = 24;
+
+/*Reusable barrier for the level steps.*/
+class level_barrier {
+    std::mutex m_;
+    std::condition_variable cv_;
+    const unsigned count_;
+    unsigned waiting_ = 0;
+    std::size_t generation_ = 0;
+public:
+    explicit level_barrier(unsigned count) : count_(count) {}
+    void wait() {
+        std::unique_lock<std::mutex> lk(m_);
+        const std::size_t gen = generation_;
+        if(++waiting_ == count_) {
+            waiting_ = 0;
+            ++generation_;
+            cv_.notify_all();
+        }
+        else {
+            cv_.wait(lk, [&]() { return gen != generation_; });
+        }
+    }
+};
+
+/*Padded so that the cursors of different threads do not share a cache line.*/
+struct alignas(64) steal_cursor {
+    std::atomic<std::size_t> pos_;
+};
+
+template<typename Index>
+class parallel_reachability {
+    const CSRGraph<Index>& out_;
+    const CSRGraph<Index>& in_;
+    const unsigned threads_;
+    atomic_bitmap_visited visited_;
+    atomic_bitmap_visited frontier_bits_;  // all clear except during bottom up levels
+    std::vector<std::vector<Index>> frontier_;
+    std::vector<std::vector<Index>> next_;
+    std::vector<steal_cursor> cursor_;
+    std::vector<std::size_t> next_degree_;
+    std::atomic<std::size_t> bottom_up_pos_;
+    level_barrier barrier_;
+    std::vector<std::thread> pool_;
+    bool stop_ = false;
+    bool bottom_up_ = false;
+    bool done_ = false;
+    std::size_t visited_count_ = 0;
+    std::size_t explored_edges_ = 0;
+    std::size_t frontier_edges_ = 0;
+    std::size_t frontier_nodes_ = 0;
+    std::size_t top_down_levels_ = 0;
+    std::size_t bottom_up_levels_ = 0;
+
+    void discover(unsigned t, Index v) {
+        next_[t].push_back(v);
+        next_degree_[t] += out_.degree(v);
+    }
+    void top_down_step(unsigned t) {
+        for(unsigned k = 0; k < threads_; ++k) {
+            const unsigned victim = (t + k) % threads_;
+            const auto& F = frontier_[victim];
+            for(std::size_t b = cursor_[victim].pos_.fetch_add(FRONTIER_CHUNK);
+                b < F.size(); b = cursor_[victim].pos_.fetch_add(FRONTIER_CHUNK)) {
+                const std::size_t e = std::min(F.size(), b + FRONTIER_CHUNK);
+                for(std::size_t i = b; i < e; ++i)
+                    for(auto v : out_.neighbors(F[i]))
+                        if(visited_.claim(v))
+                            discover(t, v);
+            }
+        }
+    }
+    void bottom_up_step(unsigned t) {
+        const std::size_t n = out_.node_count();
+        for(std::size_t b = bottom_up_pos_.fetch_add(FRONTIER_CHUNK);
+            b < n; b = bottom_up_pos_.fetch_add(FRONTIER_CHUNK)) {
+            const std::size_t e = std::min(n, b + FRONTIER_CHUNK);
+            for(std::size_t v = b; v < e; ++v) {
+                if(visited_.test(v))
+                    continue;
+                for(auto u : in_.neighbors(Index(v))) {
+                    if(frontier_bits_.test(u)) {
+                        visited_.set(v);
+                        discover(t, Index(v));
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    /*Serial part between two levels, run by thread 0 only.*/
+    void advance_level() {
+        frontier_nodes_ = 0;
+        frontier_edges_ = 0;
+        for(unsigned t = 0; t < threads_; ++t) {
+            frontier_[t].swap(next_[t]);
+            next_[t].clear();
+            cursor_[t].pos_.store(0, std::memory_order_relaxed);
+            frontier_nodes_ += frontier_[t].size();
+            frontier_edges_ += next_degree_[t];
+            next_degree_[t] = 0;
+        }
+        if(bottom_up_)
+            frontier_bits_.reset();
+        bottom_up_pos_.store(0, std::memory_order_relaxed);
+        visited_count_ += frontier_nodes_;
+        explored_edges_ += frontier_edges_;
+        done_ = frontier_nodes_ == 0;
+        const std::size_t unexplored_edges = out_.edge_count() - explored_edges_;
+        if(!bottom_up_ && frontier_edges_ > unexplored_edges / ALPHA)
+            bottom_up_ = true;
+        else if(bottom_up_ && frontier_nodes_ < out_.node_count() / BETA)
+            bottom_up_ = false;
+    }
+    void worker(unsigned t) {
+        level_barrier& B = barrier_;
+        while(true) {
+            if(bottom_up_) {
+                if(t == 0)
+                    ++bottom_up_levels_;
+                for(auto v : frontier_[t])
+                    frontier_bits_.set(v);
+                B.wait();
+                bottom_up_step(t);
+            }
+            else {
+                if(t == 0)
+                    ++top_down_levels_;
+                top_down_step(t);
+            }
+            B.wait();
+            if(t == 0)
+                advance_level();
+            B.wait();
+            if(done_)
+                return;
+        }
+    }
+public:
+    parallel_reachability(const CSRGraph<Index>& out, const CSRGraph<Index>& in, unsigned threads)
+        : out_(out), in_(in), threads_(threads), visited_(out.node_count()),
+          frontier_bits_(out.node_count()), frontier_(threads), next_(threads),
+          cursor_(threads), next_degree_(threads, 0), barrier_(threads) {
+        /*threads 1.. wait for a query on the barrier, run() is thread 0. The
+          barrier after worker() keeps run() from resetting the state of the
+          next query while a thread still has to read done_.*/
+        for(unsigned t = 1; t < threads_; ++t)
+            pool_.emplace_back([this, t]() {
+                while(true) {
+                    barrier_.wait();
+                    if(stop_)
+                        return;
+                    worker(t);
+                    barrier_.wait();
+                }
+            });
+    }
+    ~parallel_reachability() {
+        stop_ = true;
+        if(!pool_.empty())
+            barrier_.wait();
+        for(auto& th : pool_)
+            th.join();
+    }
+
+    /*Number of nodes reachable from root, root included.*/
+    std::size_t run(Index root) {
+        visited_.reset();
+        for(unsigned t = 0; t < threads_; ++t) {
+            frontier_[t].clear();
+            next_[t].clear();
+            next_degree_[t] = 0;
+        }
+        visited_count_ = explored_edges_ = 0;
+        top_down_levels_ = bottom_up_levels_ = 0;
+        bottom_up_ = false;
+        done_ = false;
+        visited_.set(root);
+        discover(0, root);
+        advance_level();
+
+        if(!pool_.empty())
+            barrier_.wait();
+        worker(0);
+        if(!pool_.empty())
+            barrier_.wait();
+        return visited_count_;
+    }
+    std::size_t top_down_levels() const { return top_down_levels_; }
+    std::size_t bottom_up_levels() const { return bottom_up_levels_; }
+    const atomic_bitmap_visited& visited() const { return visited_; }
+};
+
+/*range(0) is the GraphTopology, range(1) the number of nodes, range(2)
+  the thread count of the parallel version.*/
+constexpr static std::size_t GENERATED_DEGREE = 8;
+static CSRGraph32 generated_csr(benchmark::State& state, std::uint32_t* root) {
+    std::size_t nodes;
+    auto edges = generate_graph<std::uint32_t>(static_cast<GraphTopology>(state.range(0)),
+                                               state.range(1), GENERATED_DEGREE, 1, &nodes);
+    *root = edges.empty() ? 0 : edges[0].first;
+    return make_csr<std::uint32_t>(edges, nodes);
+}
+
+static void BM_DFA_nonrecursive_generated(benchmark::State& state) {
+    int result;
+    std::uint32_t root;
+    auto G = generated_csr(state, &root);
+    bitmap_visited store(G.node_count());
+    for(auto _ : state) {
+        result = 0;
+        store.reset();
+        DFA_iterative(G, root, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["visited"] = result;
+}
+static void BM_parallel_reachability(benchmark::State& state) {
+    std::uint32_t root;
+    auto G = generated_csr(state, &root);
+    auto T = transpose(G);
+    parallel_reachability<std::uint32_t> P(G, T, state.range(2));
+    std::size_t result = 0;
+    for(auto _ : state) {
+        result = P.run(root);
+        benchmark::DoNotOptimize(result);
+    }
+    int expected = 0;
+    bitmap_visited store(G.node_count());
+    DFA_iterative(G, root, store, expected);
+    if(result != std::size_t(expected))
+        state.SkipWithError("parallel and serial reachability differ");
+    state.counters["visited"] = result;
+    state.counters["top_down"] = P.top_down_levels();
+    state.counters["bottom_up"] = P.bottom_up_levels();
+}
+
+/*The 100 node graphs, the only size DFA_recursive can handle without
+  overflowing the stack on random graphs.*/
+static void BM_DFA_recursive(benchmark::State& state) {
+    int result;
+    auto G = make_csr<std::uint32_t>(Graph(state.range(0)).adjecency_list_);
+    bitmap_visited store(G.node_count());
+    for(auto _ : state) {
+        result = 0;
+        store.reset();
+        DFA_recursive(G, 0u, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+}
+static void BM_DFA_nonrecursive(benchmark::State& state) {
+    int result;
+    auto G = make_csr<std::uint32_t>(Graph(state.range(0)).adjecency_list_);
+    bitmap_visited store(G.node_count());
+    for(auto _ : state) {
+        result = 0;
+        store.reset();
+        DFA_iterative(G, 0u, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+}
+static void BM_parallel_reachability_small(benchmark::State& state) {
+    auto G = make_csr<std::uint32_t>(Graph(state.range(0)).adjecency_list_);
+    auto T = transpose(G);
+    parallel_reachability<std::uint32_t> P(G, T, state.range(1));
+    for(auto _ : state) {
+        std::size_t result = P.run(0);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(BM_DFA_recursive)
+    ->Arg(10)
+    ->Arg(30)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DFA_nonrecursive)
+    ->Arg(10)
+    ->Arg(30)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_parallel_reachability_small)
+    ->ArgsProduct({{10, 30}, {1, 2, 4}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DFA_nonrecursive_generated)
+    ->ArgsProduct({{ERDOS_RENYI, RMAT, GRID}, {1 << 22}, {1}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_parallel_reachability)
+    ->ArgsProduct({{ERDOS_RENYI, RMAT, GRID}, {1 << 22}, {1, 2, 4, 8, 16, 32}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_MAIN();
+
+/******
+* Linux x86_64, KVM guest, Intel Xeon (Sapphire Rapids)
+* Run on (1 X 2000 MHz CPU )
+* CPU Caches:
+*   L1 Data 48 KiB (x1)
+*   L2 Unified 2048 KiB (x1)
+*   L3 Unified 107520 KiB (x1)
+* g++ (12.2) GraphTraversal_Parallel_1.cpp -pthread -std=c++14 -lbenchmark -O3
+* Topology 0 ER, 1 R-MAT, 3 grid, 4M nodes, average degree 8. Time is wall clock.
+* BM_DFA_nonrecursive_generated/0/4194304/1             2686 ms         2653 ms   visited=4.19293M
+* BM_DFA_nonrecursive_generated/1/4194304/1              873 ms          863 ms   visited=1.62341M
+* BM_DFA_nonrecursive_generated/3/4194304/1             80.3 ms         79.8 ms   visited=4.1943M
+* BM_parallel_reachability/0/4194304/1/real_time         486 ms   bottom_up=4 top_down=7
+* BM_parallel_reachability/1/4194304/1/real_time         191 ms   bottom_up=3 top_down=5
+* BM_parallel_reachability/3/4194304/1/real_time         355 ms   bottom_up=15 top_down=4.08k
+* BM_parallel_reachability/0/4194304/4/real_time         438 ms
+* BM_parallel_reachability/1/4194304/4/real_time         253 ms
+* BM_parallel_reachability/3/4194304/4/real_time         497 ms
+* BM_parallel_reachability/0/4194304/32/real_time        447 ms
+* BM_parallel_reachability/1/4194304/32/real_time        304 ms
+* BM_parallel_reachability/3/4194304/32/real_time       2083 ms
+* BM_DFA_recursive/30                                   8.23 us
+* BM_DFA_nonrecursive/30                                15.6 us
+* BM_parallel_reachability_small/30/1                   3.45 us
+* BM_parallel_reachability_small/30/2                   53.1 us
+* BM_parallel_reachability_small/30/4                    182 us
+*
+* This box has a single core, so the thread count rows only show the overhead of
+* oversubscription, not scaling. They have to be rerun on a multi core machine.
+* What can be read from it:
+* 1) Even on one thread the direction optimized BFS is 4.5 - 5.5 times faster than
+*    DFA_iterative on the random graphs. A handful of bottom up levels, each a
+*    sequential sweep over the in-edges which stops at the first frontier parent,
+*    replaces most of the random accesses and the O(E) explicit stack.
+* 2) On the grid (diameter ~4000) it is 4.4 times slower than the DFA on one
+*    thread. A first version cleared a node_count bit frontier bitmap after every
+*    one of the 4080 levels, which was half of the time (716 ms then). Without it,
+*    the 15 bottom up levels the heuristic picks are now the largest extra cost:
+*    with them disabled (top down only) the grid takes 203 ms. Each is a sweep
+*    over all 4M nodes for a frontier of a few thousand, the BETA exit does not
+*    see that the frontier of a grid stays small relative to the graph. The
+*    remaining 2.5x over the DFA is the per level work and an atomic claim per
+*    edge. With 32 threads on one core every one of the ~12K barriers is a round
+*    of context switches, which is where the 2 s come from.
+* 3) On 100 nodes the threads are started once with the object, but handing a
+*    query to them and the barriers of a few levels still cost 15 - 50 times the
+*    traversal on one core.
+******/
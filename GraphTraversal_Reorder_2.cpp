@@ -0,0 +1,114 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+* 18th Oct, 2026
+*
+* Does relabelling the nodes of a graph (Graph_Reorder.h) pay for itself?
+* The generated graphs have their ids scrambled, the same as the random 100 node
+* tables of RecursionIteration_DFA_2.cpp: neighbours are spread over the whole id
+* space and out of cache every edge is a miss. Each benchmark reorders the graph
+* once in the setup (reported as reorder_ms) and then times DFA_iterative with a
+* bitmap visited store on the relabelled graph, starting from the relabelled root.
+* The traversal is checked to reach the same number of nodes as on the original.
+* Reorder cost / (original time - reordered time) is the number of traversals
+* needed to win the cost back.
+******/
+
+#include<chrono>
+#include<cstdint>
+#include <benchmark/benchmark.h>
+#include "RecursionIteration_DFA.h"
+#include "Graph_CSR.h"
+#include "Graph_VisitedSet.h"
+#include "Graph_Generator.h"
+#include "Graph_Reorder.h"
+#include "Benchmark_PerfCounters.h"
+
+constexpr static std::size_t GENERATED_DEGREE = 8;
+
+/*range(0) GraphTopology, range(1) nodes, range(2) ReorderKind.*/
+static void BM_DFA_reordered(benchmark::State& state) {
+    std::size_t nodes;
+    auto edges = generate_graph<std::uint32_t>(static_cast<GraphTopology>(state.range(0)),
+                                               state.range(1), GENERATED_DEGREE, 1, &nodes);
+    const std::uint32_t root = edges.empty() ? 0 : edges[0].first;
+    const auto G = make_csr<std::uint32_t>(edges, nodes);
+    EdgeList<std::uint32_t>().swap(edges);
+
+    auto start = std::chrono::steady_clock::now();
+    const auto order = reorder(G, static_cast<ReorderKind>(state.range(2)), root);
+    const auto R = relabel(G, order);
+    std::chrono::duration<double, std::milli> reorder_ms = std::chrono::steady_clock::now() - start;
+
+    int expected = 0;
+    bitmap_visited store(nodes);
+    DFA_iterative(G, root, store, expected);
+    const std::uint32_t new_root = order.new_id_[root];
+    int result;
+    perf_counters perf;
+    perf.start();
+    for(auto _ : state) {
+        result = 0;
+        store.reset();
+        DFA_iterative(R, new_root, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+    perf.stop(state);
+    if(result != expected)
+        state.SkipWithError("reordered graph reaches a different number of nodes");
+    state.counters["reorder_ms"] = reorder_ms.count();
+    state.counters["visited"] = result;
+}
+
+BENCHMARK(BM_DFA_reordered)
+    ->ArgsProduct({{ERDOS_RENYI, RMAT, POWER_LAW}, {1 << 18, 1 << 21},
+                   {ORIGINAL, BFS_ORDER, RCM_ORDER, DEGREE_ORDER, COMMUNITY_ORDER}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
+
+/******
+* Linux x86_64, KVM guest, Intel Xeon (Sapphire Rapids)
+* Run on (1 X 2000 MHz CPU )
+* CPU Caches:
+*   L1 Data 48 KiB (x1)
+*   L2 Unified 2048 KiB (x1)
+*   L3 Unified 107520 KiB (x1)
+* g++ (12.2) GraphTraversal_Reorder_2.cpp -pthread -std=c++14 -lbenchmark -O3
+* Args are topology (0 ER, 1 R-MAT, 2 power law) / nodes / order (0 original,
+* 1 BFS, 2 RCM, 3 degree, 4 community), average degree 8.
+* BM_DFA_reordered/0/2097152/0        807 ms   reorder_ms=690.71
+* BM_DFA_reordered/0/2097152/1        778 ms   reorder_ms=1.8196k
+* BM_DFA_reordered/0/2097152/2        876 ms   reorder_ms=4.12694k
+* BM_DFA_reordered/0/2097152/3       1000 ms   reorder_ms=1092.83
+* BM_DFA_reordered/0/2097152/4        995 ms   reorder_ms=9.50313k
+* BM_DFA_reordered/1/2097152/0        393 ms   reorder_ms=1060.3
+* BM_DFA_reordered/1/2097152/1        351 ms   reorder_ms=1.56579k
+* BM_DFA_reordered/1/2097152/2        191 ms   reorder_ms=2.8333k
+* BM_DFA_reordered/1/2097152/3        380 ms   reorder_ms=1.32594k
+* BM_DFA_reordered/1/2097152/4        354 ms   reorder_ms=7.32982k
+* BM_DFA_reordered/2/2097152/0        809 ms   reorder_ms=778.255
+* BM_DFA_reordered/2/2097152/1        868 ms   reorder_ms=1.76778k
+* BM_DFA_reordered/2/2097152/2        797 ms   reorder_ms=3.83754k
+* BM_DFA_reordered/2/2097152/3       1043 ms   reorder_ms=1.44184k
+* BM_DFA_reordered/2/2097152/4       1022 ms   reorder_ms=9.67179k
+* BM_DFA_reordered/1/262144/0        26.5 ms
+* BM_DFA_reordered/1/262144/2        21.3 ms
+* (reorder_ms of order 0 is building the identity permutation and copying the
+* graph through relabel, ie. the fixed part of every pass.)
+*
+* Observations :
+* 1) Reordering only paid off clearly on R-MAT, where RCM halves the traversal
+*    (393 -> 191 ms) and the ~2.8s cost is won back after 14 traversals. R-MAT has
+*    real structure for RCM to find. ER and the Chung-Lu power law graph are
+*    random by construction, there is no locality to recover and every order is
+*    within noise or worse.
+* 2) Degree and community order made the DFA slower. Grouping the hubs helps a
+*    pull style BFS, but the DFA's explicit stack visits nodes in an order which
+*    does not follow the new ids.
+* 3) The label propagation pass is the most expensive and the least useful here;
+*    a real Rabbit-order/Gorder is costlier still.
+* 4) This VM has a 100MB L3, the 2M node graphs (64MB of CSR) mostly fit into it.
+*    The win is expected to grow once the graph is well beyond the LLC.
+******/
@@ -0,0 +1,235 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+* 18th Oct, 2026
+*
+* The visitor based DFS engine of Graph_DFS.h against the two DFA implementations
+* of RecursionIteration_DFA.h, on deep graphs (chain, grid) and on a dense one.
+* Besides time each benchmark reports how much stack it needed:
+*   DFA_recursive : native stack bytes between the root frame and the deepest one,
+*                   measured with the address of a local variable.
+*   DFA_iterative : peak number of entries of its std::stack times sizeof(node).
+*   dfs_engine    : peak number of (node, cursor) frames times sizeof(frame).
+* The peaks are measured once outside of the timed loop with instrumented copies,
+* the timed loops run the original functions.
+* topological_sort and tarjan_scc are timed on the same inputs (topological sort
+* on the DAG obtained by orienting every edge from the smaller to the larger id).
+******/
+
+#include<algorithm>
+#include<cstdint>
+#include<vector>
+#include <benchmark/benchmark.h>
+#include "RecursionIteration_DFA.h"
+#include "Graph_CSR.h"
+#include "Graph_VisitedSet.h"
+#include "Graph_Generator.h"
+#include "Graph_DFS.h"
+
+/*DFA_recursive which records the native stack it used.*/
+template<typename G, typename Store>
+void DFA_recursive_stack(const G& g, typename G::node_type root, Store& store,
+                         const char*& deepest) {
+    char marker;
+    deepest = std::min<const char*>(deepest, &marker);
+    if(is_visited(root, store))
+        return;
+    set_visited(root, store);
+    for(auto i : g.neighbors(root))
+        DFA_recursive_stack(g, i, store, deepest);
+}
+/*DFA_iterative which records the size of its stack.*/
+template<typename G, typename Store>
+std::size_t DFA_iterative_peak(const G& g, typename G::node_type root, Store& store) {
+    std::stack<typename G::node_type> S;
+    std::size_t peak = 0;
+    S.push(root);
+    while(!S.empty()) {
+        peak = std::max(peak, S.size());
+        auto node = S.top();
+        S.pop();
+        if(is_visited(node, store))
+            continue;
+        set_visited(node, store);
+        for(auto i : g.neighbors(node))
+            S.push(i);
+    }
+    return peak;
+}
+
+/*Counts discovered nodes, nothing else.*/
+struct count_visitor : dfs_visitor {
+    int count_ = 0;
+    void discover(std::uint32_t) { ++count_; }
+};
+
+/*range(0) GraphTopology, range(1) nodes, range(2) average degree.*/
+static CSRGraph32 input_graph(benchmark::State& state, bool dag = false) {
+    std::size_t nodes;
+    auto edges = generate_graph<std::uint32_t>(static_cast<GraphTopology>(state.range(0)),
+                                               state.range(1), state.range(2), 1, &nodes);
+    if(dag) {
+        edges.erase(std::remove_if(edges.begin(), edges.end(),
+                                   [](const std::pair<std::uint32_t, std::uint32_t>& e) {
+                                       return e.first == e.second; }),
+                    edges.end());
+        for(auto& e : edges)
+            if(e.first > e.second)
+                std::swap(e.first, e.second);
+    }
+    return make_csr<std::uint32_t>(edges, nodes);
+}
+
+static void BM_DFA_recursive(benchmark::State& state) {
+    auto G = input_graph(state);
+    bitmap_visited store(G.node_count());
+    int result;
+    for(auto _ : state) {
+        result = 0;
+        store.reset();
+        DFA_recursive(G, 0u, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+    /*the stack grows down, the deepest frame has the lowest address*/
+    char base;
+    const char* deepest = &base;
+    store.reset();
+    DFA_recursive_stack(G, 0u, store, deepest);
+    state.counters["peak_stack_bytes"] = &base - deepest;
+    state.counters["visited"] = result;
+}
+static void BM_DFA_nonrecursive(benchmark::State& state) {
+    auto G = input_graph(state);
+    bitmap_visited store(G.node_count());
+    int result;
+    for(auto _ : state) {
+        result = 0;
+        store.reset();
+        DFA_iterative(G, 0u, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+    store.reset();
+    state.counters["peak_stack_bytes"] = DFA_iterative_peak(G, 0u, store) * sizeof(std::uint32_t);
+    state.counters["visited"] = result;
+}
+static void BM_dfs_engine(benchmark::State& state) {
+    auto G = input_graph(state);
+    dfs_engine<CSRGraph32> dfs(G, G.node_count());
+    int result = 0;
+    for(auto _ : state) {
+        count_visitor vis;
+        dfs.reset();
+        dfs.visit(0u, vis);
+        result = vis.count_;
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["peak_stack_bytes"] = dfs.peak_stack_bytes();
+    state.counters["visited"] = result;
+}
+static void BM_topological_sort(benchmark::State& state) {
+    auto G = input_graph(state, true);
+    std::vector<std::uint32_t> order;
+    bool acyclic = false;
+    for(auto _ : state) {
+        acyclic = topological_sort(G, G.node_count(), order);
+        benchmark::DoNotOptimize(acyclic);
+    }
+    if(!acyclic)
+        state.SkipWithError("cycle reported in a DAG");
+    /*every edge has to go forward in the order*/
+    std::vector<std::uint32_t> position(G.node_count());
+    for(std::size_t i = 0; i < order.size(); ++i)
+        position[order[i]] = i;
+    for(std::size_t u = 0; u < G.node_count(); ++u)
+        for(auto v : G.neighbors(std::uint32_t(u)))
+            if(position[u] >= position[v])
+                state.SkipWithError("not a topological order");
+}
+static void BM_tarjan_scc(benchmark::State& state) {
+    auto G = input_graph(state);
+    std::vector<std::uint32_t> component;
+    std::size_t components = 0;
+    for(auto _ : state) {
+        components = tarjan_scc(G, G.node_count(), component);
+        benchmark::DoNotOptimize(components);
+    }
+    /*no edge may go from an earlier completed component to a later one*/
+    for(std::size_t u = 0; u < G.node_count(); ++u)
+        for(auto v : G.neighbors(std::uint32_t(u)))
+            if(component[u] < component[v])
+                state.SkipWithError("edge against the SCC completion order");
+    state.counters["components"] = components;
+}
+
+/*deep: chain and grid, sparse and dense random graphs*/
+static void dfs_inputs(benchmark::internal::Benchmark* b) {
+    b->Args({CHAIN, 1 << 16, 1});
+    b->Args({GRID, 1 << 16, 4});
+    b->Args({ERDOS_RENYI, 1 << 16, 4});
+    b->Args({ERDOS_RENYI, 1 << 12, 64});
+}
+
+BENCHMARK(BM_DFA_recursive)
+    ->Apply(dfs_inputs)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DFA_nonrecursive)
+    ->Apply(dfs_inputs)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_dfs_engine)
+    ->Apply(dfs_inputs)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_topological_sort)
+    ->Apply(dfs_inputs)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_tarjan_scc)
+    ->Apply(dfs_inputs)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_MAIN();
+
+/******
+* Linux x86_64, KVM guest, Intel Xeon (Sapphire Rapids)
+* Run on (1 X 2000 MHz CPU )
+* CPU Caches:
+*   L1 Data 48 KiB (x1)
+*   L2 Unified 2048 KiB (x1)
+*   L3 Unified 107520 KiB (x1)
+* g++ (12.2) GraphTraversal_VisitorDFS_4.cpp -pthread -std=c++14 -lbenchmark -O3
+* Args are topology (0 ER, 3 grid, 4 chain) / nodes / average degree.
+* BM_DFA_recursive/4/65536/1           567 us   peak_stack_bytes=2.21356M visited=65.536k
+* BM_DFA_recursive/3/65536/4           846 us   peak_stack_bytes=2.21356M visited=65.536k
+* BM_DFA_recursive/0/65536/4          3496 us   peak_stack_bytes=1.3116M  visited=64.282k
+* BM_DFA_recursive/0/4096/64           631 us   peak_stack_bytes=135.116k visited=4.096k
+* BM_DFA_nonrecursive/4/65536/1        492 us   peak_stack_bytes=4        visited=65.536k
+* BM_DFA_nonrecursive/3/65536/4       1161 us   peak_stack_bytes=391.18k  visited=65.536k
+* BM_DFA_nonrecursive/0/65536/4       3780 us   peak_stack_bytes=426.272k visited=64.282k
+* BM_DFA_nonrecursive/0/4096/64       1144 us   peak_stack_bytes=962.528k visited=4.096k
+* BM_dfs_engine/4/65536/1             1207 us   peak_stack_bytes=1.57286M visited=65.536k
+* BM_dfs_engine/3/65536/4             1711 us   peak_stack_bytes=1.57286M visited=65.536k
+* BM_dfs_engine/0/65536/4             4911 us   peak_stack_bytes=931.872k visited=64.282k
+* BM_dfs_engine/0/4096/64              502 us   peak_stack_bytes=96.096k  visited=4.096k
+* BM_topological_sort/4/65536/1       1473 us
+* BM_topological_sort/3/65536/4       3804 us
+* BM_topological_sort/0/65536/4       5643 us
+* BM_topological_sort/0/4096/64        846 us
+* BM_tarjan_scc/4/65536/1             2313 us   components=65.536k
+* BM_tarjan_scc/3/65536/4             3450 us   components=1
+* BM_tarjan_scc/0/65536/4            16305 us   components=2.611k
+* BM_tarjan_scc/0/4096/64             2799 us   components=1
+*
+* Observations :
+* 1) The engine needs 24 bytes per node of depth (node, cursor, end), the recursion
+*    about 34 bytes per level of native stack. Both are O(depth), on the chain and
+*    the grid the DFS path is the whole graph, 65536 frames deep.
+* 2) DFA_iterative's stack depends on the edges, not the depth. On the chain it
+*    never holds more than one node, on the dense graph it holds 240K entries
+*    (almost every edge) where the engine holds 4K frames: 10x less memory.
+* 3) On sparse inputs the engine is 1.3 - 2x slower than both DFAs. It does more
+*    per edge (colour check, frame reload after every push) and the DFAs do not
+*    need a finish event. On the dense graph it is the fastest: 2.3x DFA_iterative
+*    which pushes and pops every edge, 1.25x the recursion.
+* 4) topological_sort and tarjan_scc add the visitor work on top of the engine,
+*    Tarjan on the sparse ER graph pays for the index/low arrays being random
+*    accessed (3x the plain engine).
+******/
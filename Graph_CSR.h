@@ -0,0 +1,106 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* Compressed sparse row (CSR) form of a graph. All the adjacency lists are
+* concatenated into one neighbors_ array and offsets_[n]..offsets_[n+1] is
+* the slice of node n. Compared to std::vector<std::vector<int>> there is a
+* single allocation for the whole graph, no 24 byte vector header per node
+* and no pointer to chase before the neighbours can be read.
+* The index type is a template parameter, 32 bit is enough for up to 4G
+* nodes/edges, 64 bit is for anything bigger.
+******/
+#ifndef GRAPH_CSR_H
+#define GRAPH_CSR_H
+
+#include<cstddef>
+#include<cstdint>
+#include<utility>
+#include<vector>
+
+template<typename Index>
+struct CSRGraph {
+    typedef Index node_type;
+    /*Neighbours of one node, enough of a range for range based for.*/
+    struct neighbor_range {
+        const Index* begin_;
+        const Index* end_;
+        const Index* begin() const { return begin_; }
+        const Index* end() const { return end_; }
+        std::size_t size() const { return end_ - begin_; }
+    };
+
+    std::vector<Index> offsets_;
+    std::vector<Index> neighbors_;
+
+    std::size_t node_count() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+    std::size_t edge_count() const { return neighbors_.size(); }
+    std::size_t degree(Index node) const { return offsets_[node + 1] - offsets_[node]; }
+    neighbor_range neighbors(Index node) const {
+        const Index* base = neighbors_.data();
+        return { base + offsets_[node], base + offsets_[node + 1] };
+    }
+};
+typedef CSRGraph<std::uint32_t> CSRGraph32;
+typedef CSRGraph<std::uint64_t> CSRGraph64;
+
+/*Directed edges as (source, destination).*/
+template<typename Index>
+using EdgeList = std::vector<std::pair<Index, Index>>;
+
+/*Builds the CSR form from a directed edge list with a counting sort on the
+  source node. Neighbours of a node keep the order they had in the list.*/
+template<typename Index, typename Edge>
+CSRGraph<Index> make_csr(const std::vector<Edge>& edges, std::size_t node_count) {
+    CSRGraph<Index> G;
+    G.offsets_.assign(node_count + 1, 0);
+    for(const auto& e : edges)
+        ++G.offsets_[e.first + 1];
+    for(std::size_t i = 0; i < node_count; ++i)
+        G.offsets_[i + 1] += G.offsets_[i];
+    G.neighbors_.resize(edges.size());
+    std::vector<Index> cursor(G.offsets_.begin(), G.offsets_.end() - 1);
+    for(const auto& e : edges)
+        G.neighbors_[cursor[e.first]++] = static_cast<Index>(e.second);
+    return G;
+}
+
+/*Builds the CSR form from adjacency lists, eg. Graph::adjecency_list_.*/
+template<typename Index, typename AdjList>
+CSRGraph<Index> make_csr(const std::vector<AdjList>& adjacency) {
+    CSRGraph<Index> G;
+    G.offsets_.reserve(adjacency.size() + 1);
+    G.offsets_.push_back(0);
+    std::size_t edges = 0;
+    for(const auto& l : adjacency) {
+        edges += l.size();
+        G.offsets_.push_back(static_cast<Index>(edges));
+    }
+    G.neighbors_.reserve(edges);
+    for(const auto& l : adjacency)
+        for(auto n : l)
+            G.neighbors_.push_back(static_cast<Index>(n));
+    return G;
+}
+
+/*Same graph with every edge reversed, ie. in-neighbours instead of out-neighbours.*/
+template<typename Index>
+CSRGraph<Index> transpose(const CSRGraph<Index>& G) {
+    const std::size_t n = G.node_count();
+    CSRGraph<Index> T;
+    T.offsets_.assign(n + 1, 0);
+    for(auto v : G.neighbors_)
+        ++T.offsets_[v + 1];
+    for(std::size_t i = 0; i < n; ++i)
+        T.offsets_[i + 1] += T.offsets_[i];
+    T.neighbors_.resize(G.neighbors_.size());
+    std::vector<Index> cursor(T.offsets_.begin(), T.offsets_.end() - 1);
+    for(std::size_t u = 0; u < n; ++u)
+        for(auto v : G.neighbors(Index(u)))
+            T.neighbors_[cursor[v]++] = Index(u);
+    return T;
+}
+
+#endif
@@ -0,0 +1,168 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* Connected components of a graph, edge direction ignored (weakly connected
+* components of a directed graph), in parallel.
+*
+* concurrent_union_find : lock free disjoint sets over node ids. A root is only
+*     ever linked below a smaller root, with a CAS on its parent, and find does
+*     path halving with a CAS which only replaces a parent by its own parent. So
+*     parent(x) <= x at all times, the parents only decrease, no cycle can form
+*     whatever the interleaving and relaxed atomics are enough. It also means the
+*     root of a set is its smallest node.
+* union_find_components : every edge is one unite, nodes are split into chunks
+*     over the threads. Works on any graph with neighbors() (Graph, CSRGraph,
+*     MappedGraph, ...).
+* afforest_components : Afforest (Sutton et al., IPDPS 2018), which is Shiloach-
+*     Vishkin style linking with subgraph sampling. First only the first
+*     `rounds` neighbours of every node are linked, which on most graphs already
+*     forms the giant component. Its root is found by sampling nodes, then the
+*     remaining edges are processed only for nodes outside of it, nodes inside
+*     are skipped with all their edges. For a directed graph an edge from inside
+*     to outside is then only seen from its destination, so the in-edges of the
+*     outside nodes are processed as well. Needs random access neighbour ranges
+*     and the transpose (like parallel_reachability).
+* Both write label[v] = the smallest node of v's component, so the labels do
+* not depend on the method or the number of threads, and return the number of
+* components.
+******/
+#ifndef GRAPH_COMPONENTS_H
+#define GRAPH_COMPONENTS_H
+
+#include<algorithm>
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<random>
+#include<unordered_map>
+#include<vector>
+#include "Graph_CSR.h"
+#include "Graph_Generator.h"
+
+constexpr static std::size_t CHUNK_NODES = 1 << 12;
+
+template<typename Index>
+class concurrent_union_find {
+    std::vector<std::atomic<Index>> parent_;
+public:
+    explicit concurrent_union_find(std::size_t node_count, unsigned threads = 0)
+        : parent_(node_count) { reset(threads); }
+
+    void reset(unsigned threads = 0) {
+        parallel_for_chunks(parent_.size(), CHUNK_NODES, [&](std::size_t b, std::size_t e, std::size_t) {
+            for(std::size_t v = b; v < e; ++v)
+                parent_[v].store(Index(v), std::memory_order_relaxed);
+        }, threads);
+    }
+    Index find(Index x) {
+        for(;;) {
+            Index p = parent_[x].load(std::memory_order_relaxed);
+            if(p == x)
+                return x;
+            Index gp = parent_[p].load(std::memory_order_relaxed);
+            if(gp != p)
+                parent_[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+            x = gp;
+        }
+    }
+    /*Returns false if a and b were already in the same set.*/
+    bool unite(Index a, Index b) {
+        for(;;) {
+            a = find(a);
+            b = find(b);
+            if(a == b)
+                return false;
+            if(a < b)
+                std::swap(a, b);
+            Index expected = a;
+            if(parent_[a].compare_exchange_strong(expected, b, std::memory_order_relaxed))
+                return true;
+        }
+    }
+    /*Points every node straight at its root.*/
+    void compress(unsigned threads = 0) {
+        parallel_for_chunks(parent_.size(), CHUNK_NODES, [&](std::size_t b, std::size_t e, std::size_t) {
+            for(std::size_t v = b; v < e; ++v)
+                parent_[v].store(find(Index(v)), std::memory_order_relaxed);
+        }, threads);
+    }
+    std::size_t size() const { return parent_.size(); }
+};
+
+/*label[v] = root of v, returns the number of roots.*/
+template<typename Index>
+std::size_t write_labels(concurrent_union_find<Index>& uf, std::vector<Index>& label, unsigned threads) {
+    label.resize(uf.size());
+    std::atomic<std::size_t> roots(0);
+    parallel_for_chunks(uf.size(), CHUNK_NODES, [&](std::size_t b, std::size_t e, std::size_t) {
+        std::size_t r = 0;
+        for(std::size_t v = b; v < e; ++v) {
+            label[v] = uf.find(Index(v));
+            r += label[v] == Index(v);
+        }
+        roots += r;
+    }, threads);
+    return roots;
+}
+
+template<typename Index, typename G>
+std::size_t union_find_components(const G& g, std::size_t node_count, std::vector<Index>& label,
+                                  unsigned threads = 0) {
+    concurrent_union_find<Index> uf(node_count, threads);
+    parallel_for_chunks(node_count, CHUNK_NODES, [&](std::size_t b, std::size_t e, std::size_t) {
+        for(std::size_t u = b; u < e; ++u)
+            for(auto v : g.neighbors(typename G::node_type(u)))
+                uf.unite(Index(u), Index(v));
+    }, threads);
+    return write_labels(uf, label, threads);
+}
+
+template<typename Index, typename G>
+std::size_t afforest_components(const G& out, const CSRGraph<Index>& in, std::size_t node_count,
+                                std::vector<Index>& label, unsigned threads = 0,
+                                unsigned rounds = 2, std::size_t samples = 1024) {
+    typedef typename G::node_type node_type;
+    concurrent_union_find<Index> uf(node_count, threads);
+    for(unsigned r = 0; r < rounds; ++r) {
+        parallel_for_chunks(node_count, CHUNK_NODES, [&](std::size_t b, std::size_t e, std::size_t) {
+            for(std::size_t u = b; u < e; ++u) {
+                auto n = out.neighbors(node_type(u));
+                if(std::size_t(n.end() - n.begin()) > r)
+                    uf.unite(Index(u), Index(n.begin()[r]));
+            }
+        }, threads);
+        uf.compress(threads);
+    }
+    /*the most frequent root among a few random nodes is the giant component*/
+    Index giant = 0;
+    if(node_count) {
+        std::mt19937_64 gen(node_count);
+        std::uniform_int_distribution<std::size_t> pick(0, node_count - 1);
+        std::unordered_map<Index, std::size_t> seen;
+        std::size_t best = 0;
+        for(std::size_t i = 0; i < samples; ++i) {
+            const Index root = uf.find(Index(pick(gen)));
+            if(++seen[root] > best) {
+                best = seen[root];
+                giant = root;
+            }
+        }
+    }
+    parallel_for_chunks(node_count, CHUNK_NODES, [&](std::size_t b, std::size_t e, std::size_t) {
+        for(std::size_t u = b; u < e; ++u) {
+            if(uf.find(Index(u)) == giant)
+                continue;
+            auto n = out.neighbors(node_type(u));
+            for(auto v = n.begin() + std::min<std::size_t>(rounds, n.end() - n.begin()); v != n.end(); ++v)
+                uf.unite(Index(u), Index(*v));
+            for(auto v : in.neighbors(Index(u)))
+                uf.unite(Index(u), v);
+        }
+    }, threads);
+    return write_labels(uf, label, threads);
+}
+
+#endif
@@ -0,0 +1,209 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* Compressed adjacency lists. Every neighbour list is sorted and stored as the
+* gaps between consecutive neighbours, which are small numbers when the list is
+* long or the ids are local (after Graph_Reorder.h), in group varint form:
+*     [degree as LEB128 varint] then per 4 gaps [tag byte][1 - 4 bytes per gap]
+* The tag holds the byte length - 1 of each of the 4 gaps in 2 bits. The first
+* gap is the zigzag encoded difference to the node's own id, the last group is
+* padded with zero gaps. offsets_[n] is the byte position of node n's list.
+*
+* neighbors(n) is a range whose iterator decodes one group of 4 at a time, so
+* DFA_recursive, DFA_iterative and dfs_engine walk it exactly like the
+* neighbor_range of CSRGraph. With SSSE3 (-mssse3 or -mavx2) a group is decoded
+* with one pshufb driven by a 256 entry table indexed by the tag, followed by a
+* 4 lane prefix sum, without it by a loop over the 4 lengths. Either way a group
+* may read up to 16 bytes past its tag, data_ carries that much slack at the end.
+******/
+#ifndef GRAPH_COMPRESSED_H
+#define GRAPH_COMPRESSED_H
+
+#include<algorithm>
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
+#include<vector>
+#include "Graph_CSR.h"
+#ifdef __SSSE3__
+#include<tmmintrin.h>
+#endif
+
+namespace group_varint {
+
+constexpr static std::size_t SLACK = 16;
+
+inline unsigned byte_length(std::uint32_t v) {
+    return v < (1u << 8) ? 1 : v < (1u << 16) ? 2 : v < (1u << 24) ? 3 : 4;
+}
+inline std::uint32_t zigzag(std::int32_t v) { return (std::uint32_t(v) << 1) ^ std::uint32_t(v >> 31); }
+inline std::int32_t unzigzag(std::uint32_t v) { return std::int32_t(v >> 1) ^ -std::int32_t(v & 1); }
+
+/*Appends one group of 4 values.*/
+inline void encode(const std::uint32_t* v, std::vector<std::uint8_t>& out) {
+    std::uint8_t tag = 0;
+    for(unsigned i = 0; i < 4; ++i)
+        tag |= (byte_length(v[i]) - 1) << (2 * i);
+    out.push_back(tag);
+    for(unsigned i = 0; i < 4; ++i)
+        for(unsigned b = 0; b < byte_length(v[i]); ++b)
+            out.push_back(std::uint8_t(v[i] >> (8 * b)));
+}
+
+/*Value of byte length len (1 - 4) at p, p must have 4 readable bytes.*/
+inline std::uint32_t load(const std::uint8_t* p, unsigned len) {
+    std::uint32_t v;
+    std::memcpy(&v, p, 4);
+    return len == 4 ? v : v & ((1u << (8 * len)) - 1);
+}
+/*First value of the group at p.*/
+inline std::uint32_t first(const std::uint8_t* p) { return load(p + 1, (*p & 3) + 1); }
+
+/*Per tag: total length of the group including the tag, and the pshufb mask
+  which moves the bytes of each value to its 32 bit lane.*/
+struct tables {
+    std::uint8_t length_[256];
+    std::uint8_t shuffle_[256][16];
+    tables() {
+        for(unsigned tag = 0; tag < 256; ++tag) {
+            unsigned pos = 0;
+            for(unsigned i = 0; i < 4; ++i) {
+                const unsigned len = ((tag >> (2 * i)) & 3) + 1;
+                for(unsigned b = 0; b < 4; ++b)
+                    shuffle_[tag][4 * i + b] = b < len ? std::uint8_t(pos + b) : 0x80;
+                pos += len;
+            }
+            length_[tag] = std::uint8_t(pos + 1);
+        }
+    }
+};
+inline const tables& table() {
+    static const tables t;
+    return t;
+}
+
+/*Decodes the group at p into 4 absolute values, prev is the value before the
+  group and first_fix is added to the first gap (used to undo the zigzag of
+  the first group). Returns the position of the next group.*/
+inline const std::uint8_t* decode(const std::uint8_t* p, std::uint32_t prev,
+                                  std::uint32_t first_fix, std::uint32_t* out) {
+    const tables& t = table();
+    const std::uint8_t tag = *p;
+#ifdef __SSSE3__
+    __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 1));
+    __m128i x = _mm_shuffle_epi8(raw, _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.shuffle_[tag])));
+    x = _mm_add_epi32(x, _mm_cvtsi32_si128(int(first_fix)));
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+    x = _mm_add_epi32(x, _mm_set1_epi32(int(prev)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), x);
+#else
+    const std::uint8_t* q = p + 1;
+    for(unsigned i = 0; i < 4; ++i) {
+        const unsigned len = ((tag >> (2 * i)) & 3) + 1;
+        prev += load(q, len) + (i == 0 ? first_fix : 0);
+        out[i] = prev;
+        q += len;
+    }
+#endif
+    return p + t.length_[tag];
+}
+
+}
+
+template<typename Index>
+class CompressedGraph {
+    static_assert(sizeof(Index) <= 4, "gaps and decoded ids are 32 bit");
+    std::vector<std::uint64_t> offsets_;
+    std::vector<std::uint8_t> data_;
+    std::size_t edge_count_ = 0;
+public:
+    typedef Index node_type;
+
+    class iterator {
+        const std::uint8_t* p_ = nullptr;
+        std::uint32_t buf_[4];
+        std::uint32_t remaining_ = 0;
+        unsigned pos_ = 0;
+    public:
+        iterator() = default;
+        iterator(const std::uint8_t* p, std::uint32_t degree, Index node) : remaining_(degree) {
+            if(degree == 0)
+                return;
+            /*the first gap is zigzag(v0 - node), the decode adds v0 - gap to it*/
+            const std::uint32_t zz = group_varint::first(p);
+            const std::uint32_t v0 = std::uint32_t(node) + std::uint32_t(group_varint::unzigzag(zz));
+            p_ = group_varint::decode(p, 0, v0 - zz, buf_);
+        }
+        Index operator*() const { return Index(buf_[pos_]); }
+        iterator& operator++() {
+            if(--remaining_ != 0 && ++pos_ == 4) {
+                p_ = group_varint::decode(p_, buf_[3], 0, buf_);
+                pos_ = 0;
+            }
+            return *this;
+        }
+        bool operator==(const iterator& o) const { return remaining_ == o.remaining_; }
+        bool operator!=(const iterator& o) const { return remaining_ != o.remaining_; }
+    };
+    struct neighbor_range {
+        iterator begin_;
+        std::uint32_t degree_;
+        iterator begin() const { return begin_; }
+        iterator end() const { return iterator(); }
+        std::size_t size() const { return degree_; }
+    };
+
+    /*Sorts every list of G and encodes it.*/
+    explicit CompressedGraph(const CSRGraph<Index>& G) {
+        const std::size_t n = G.node_count();
+        offsets_.reserve(n + 1);
+        data_.reserve(G.edge_count() + 2 * n);
+        std::vector<std::uint32_t> list;
+        for(std::size_t u = 0; u < n; ++u) {
+            offsets_.push_back(data_.size());
+            auto r = G.neighbors(Index(u));
+            list.assign(r.begin(), r.end());
+            std::sort(list.begin(), list.end());
+            for(std::uint32_t d = std::uint32_t(list.size()); ; d >>= 7) {
+                data_.push_back(std::uint8_t((d & 0x7f) | (d >= 0x80 ? 0x80 : 0)));
+                if(d < 0x80)
+                    break;
+            }
+            std::uint32_t prev = std::uint32_t(u);
+            for(std::size_t i = 0; i < list.size(); i += 4) {
+                std::uint32_t gap[4] = {0, 0, 0, 0};
+                for(std::size_t j = 0; j < 4 && i + j < list.size(); ++j) {
+                    gap[j] = i + j == 0 ? group_varint::zigzag(std::int32_t(list[0] - prev))
+                                        : list[i + j] - prev;
+                    prev = list[i + j];
+                }
+                group_varint::encode(gap, data_);
+            }
+        }
+        offsets_.push_back(data_.size());
+        data_.resize(data_.size() + group_varint::SLACK, 0);
+        data_.shrink_to_fit();
+        edge_count_ = G.edge_count();
+    }
+
+    std::size_t node_count() const { return offsets_.size() - 1; }
+    std::size_t edge_count() const { return edge_count_; }
+    /*memory held by the encoded lists and the offsets*/
+    std::size_t bytes() const { return data_.size() + offsets_.size() * sizeof(std::uint64_t); }
+    neighbor_range neighbors(Index node) const {
+        const std::uint8_t* p = data_.data() + offsets_[node];
+        std::uint32_t degree = 0;
+        for(unsigned shift = 0; ; shift += 7) {
+            degree |= std::uint32_t(*p & 0x7f) << shift;
+            if(!(*p++ & 0x80))
+                break;
+        }
+        return { iterator(p, degree, node), degree };
+    }
+};
+
+#endif
@@ -0,0 +1,193 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* An iterative DFS which is a real DFS. DFA_iterative in RecursionIteration_DFA.h
+* pushes all neighbours of a node when it is popped, so its stack holds up to O(E)
+* nodes and the visit order is not the recursive one: a node is finished long
+* before its descendants are, post order algorithms can not be built on it.
+* dfs_engine keeps one (node, neighbour cursor) frame per node on the current
+* path, exactly what the recursion keeps in its native frames, so the stack is
+* O(depth) and discover/finish happen in the recursive order.
+*
+* The visitor is a template parameter and every callback is a plain inline call,
+* a visitor which does not care about an event inherits the empty one from
+* dfs_visitor and it compiles to nothing.
+*   discover(u)                 u is reached for the first time
+*   finish(u)                   all of u's edges are done
+*   tree_edge(u, v)             v is discovered through u
+*   finish_edge(u, v)           returning from tree edge u -> v, v is finished
+*   back_edge(u, v)             v is on the current path, the edge closes a cycle
+*   forward_or_cross_edge(u, v) v is already finished
+* Node colours are one byte per node: white (not seen), gray (on the path),
+* black (finished).
+*
+* topological_sort and tarjan_scc are built on the engine.
+******/
+#ifndef GRAPH_DFS_H
+#define GRAPH_DFS_H
+
+#include<algorithm>
+#include<cstddef>
+#include<cstdint>
+#include<utility>
+#include<vector>
+
+struct dfs_visitor {
+    template<typename Node> void discover(Node) {}
+    template<typename Node> void finish(Node) {}
+    template<typename Node> void tree_edge(Node, Node) {}
+    template<typename Node> void finish_edge(Node, Node) {}
+    template<typename Node> void back_edge(Node, Node) {}
+    template<typename Node> void forward_or_cross_edge(Node, Node) {}
+};
+
+template<typename G>
+class dfs_engine {
+public:
+    typedef typename G::node_type node_type;
+    enum Color : std::uint8_t {WHITE = 0, GRAY = 1, BLACK = 2};
+private:
+    typedef decltype(std::declval<const G&>().neighbors(node_type()).begin()) cursor_type;
+    struct frame {
+        node_type node_;
+        cursor_type cur_;
+        cursor_type end_;
+    };
+    const G& g_;
+    std::vector<std::uint8_t> color_;
+    std::vector<frame> stack_;
+    std::size_t peak_depth_ = 0;
+
+    template<typename Visitor>
+    void push(node_type v, Visitor& vis) {
+        color_[v] = GRAY;
+        vis.discover(v);
+        auto r = g_.neighbors(v);
+        stack_.push_back({ v, r.begin(), r.end() });
+        peak_depth_ = std::max(peak_depth_, stack_.size());
+    }
+public:
+    dfs_engine(const G& g, std::size_t node_count) : g_(g), color_(node_count, WHITE) {}
+
+    void reset() {
+        std::fill(color_.begin(), color_.end(), std::uint8_t(WHITE));
+        peak_depth_ = 0;
+    }
+    /*DFS from root, nodes already black or gray are left alone.*/
+    template<typename Visitor>
+    void visit(node_type root, Visitor& vis) {
+        if(color_[root] != WHITE)
+            return;
+        push(root, vis);
+        while(!stack_.empty()) {
+            frame& f = stack_.back();
+            if(f.cur_ == f.end_) {
+                const node_type u = f.node_;
+                color_[u] = BLACK;
+                vis.finish(u);
+                stack_.pop_back();
+                if(!stack_.empty())
+                    vis.finish_edge(stack_.back().node_, u);
+                continue;
+            }
+            const node_type u = f.node_;
+            const node_type v = *f.cur_;
+            ++f.cur_;
+            /*f is not used after push, push_back may move the frames*/
+            if(color_[v] == WHITE) {
+                vis.tree_edge(u, v);
+                push(v, vis);
+            }
+            else if(color_[v] == GRAY) {
+                vis.back_edge(u, v);
+            }
+            else {
+                vis.forward_or_cross_edge(u, v);
+            }
+        }
+    }
+    /*DFS forest over all nodes, roots in id order.*/
+    template<typename Visitor>
+    void visit_all(Visitor& vis) {
+        for(std::size_t v = 0; v < color_.size(); ++v)
+            visit(node_type(v), vis);
+    }
+    Color color(node_type v) const { return Color(color_[v]); }
+    std::size_t peak_depth() const { return peak_depth_; }
+    std::size_t peak_stack_bytes() const { return peak_depth_ * sizeof(frame); }
+};
+
+/*Reverse finish order. Returns false (order incomplete) if the graph has a cycle.*/
+template<typename G>
+bool topological_sort(const G& g, std::size_t node_count, std::vector<typename G::node_type>& order) {
+    typedef typename G::node_type node_type;
+    struct topo_visitor : dfs_visitor {
+        std::vector<node_type>* order_;
+        bool acyclic_ = true;
+        void finish(node_type u) { order_->push_back(u); }
+        void back_edge(node_type, node_type) { acyclic_ = false; }
+    };
+    order.clear();
+    order.reserve(node_count);
+    topo_visitor vis;
+    vis.order_ = &order;
+    dfs_engine<G> dfs(g, node_count);
+    dfs.visit_all(vis);
+    std::reverse(order.begin(), order.end());
+    return vis.acyclic_;
+}
+
+/*Tarjan's strongly connected components. component[v] receives the component
+  number of v, numbered in the order they are completed (which is a reverse
+  topological order of the condensation). Returns the number of components.*/
+template<typename G>
+std::size_t tarjan_scc(const G& g, std::size_t node_count, std::vector<std::uint32_t>& component) {
+    typedef typename G::node_type node_type;
+    const std::uint32_t NONE = ~std::uint32_t(0);
+    struct scc_visitor : dfs_visitor {
+        std::vector<std::uint32_t> index_;
+        std::vector<std::uint32_t> low_;
+        std::vector<node_type> path_;
+        std::vector<std::uint32_t>* component_;
+        std::uint32_t next_index_ = 0;
+        std::uint32_t components_ = 0;
+        std::uint32_t none_;
+
+        void discover(node_type u) {
+            index_[u] = low_[u] = next_index_++;
+            path_.push_back(u);
+        }
+        /*v gray, or black but not yet assigned, is still on the Tarjan stack*/
+        void back_edge(node_type u, node_type v) { low_[u] = std::min(low_[u], index_[v]); }
+        void forward_or_cross_edge(node_type u, node_type v) {
+            if((*component_)[v] == none_)
+                low_[u] = std::min(low_[u], index_[v]);
+        }
+        void finish_edge(node_type u, node_type v) { low_[u] = std::min(low_[u], low_[v]); }
+        void finish(node_type u) {
+            if(low_[u] != index_[u])
+                return;
+            node_type w;
+            do {
+                w = path_.back();
+                path_.pop_back();
+                (*component_)[w] = components_;
+            } while(w != u);
+            ++components_;
+        }
+    };
+    component.assign(node_count, NONE);
+    scc_visitor vis;
+    vis.index_.assign(node_count, 0);
+    vis.low_.assign(node_count, 0);
+    vis.component_ = &component;
+    vis.none_ = NONE;
+    dfs_engine<G> dfs(g, node_count);
+    dfs.visit_all(vis);
+    return vis.components_;
+}
+
+#endif
@@ -0,0 +1,222 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* Reading and writing edge lists, so that real graphs (or generated ones saved
+* once) can be fed to the traversal benchmarks.
+*
+* Text format : one "source destination" pair per line, separated by spaces or
+*               tabs. Lines starting with '#' or '%' are comments (SNAP and
+*               MatrixMarket style headers are skipped that way).
+* Binary format: EdgeListHeader followed by edge_count pairs of index_bytes wide
+*               little endian integers, exactly the in memory EdgeList layout.
+*
+* Both loaders read with pread from all hardware threads. The text loader splits
+* the file into one range per thread, moves every range start to the next line,
+* parses the ranges independently and concatenates the results in file order.
+* Loaders return false (and leave edges empty) when the file can not be read or
+* is not in the expected format, eg. a binary file whose size does not match
+* its header.
+* Linux/POSIX only.
+******/
+#ifndef GRAPH_EDGELISTIO_H
+#define GRAPH_EDGELISTIO_H
+
+#include<algorithm>
+#include<atomic>
+#include<cstdint>
+#include<cstdio>
+#include<cstring>
+#include<string>
+#include<thread>
+#include<vector>
+#include<fcntl.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#include "Graph_CSR.h"
+#include "Graph_Generator.h"
+
+struct EdgeListHeader {
+    char magic_[8];
+    std::uint32_t version_;
+    std::uint32_t index_bytes_;
+    std::uint64_t edge_count_;
+};
+constexpr static char EDGELIST_MAGIC[8] = {'S','P','E','D','G','E','S','\0'};
+constexpr static std::uint32_t EDGELIST_VERSION = 1;
+constexpr static std::size_t IO_CHUNK_BYTES = 16 << 20;
+
+/*Number of nodes an edge list refers to, ie. largest id + 1.*/
+template<typename Index>
+std::size_t edge_list_node_count(const EdgeList<Index>& edges) {
+    Index max_id = 0;
+    for(const auto& e : edges)
+        max_id = std::max(max_id, std::max(e.first, e.second));
+    return edges.empty() ? 0 : std::size_t(max_id) + 1;
+}
+
+/*Reads size bytes at offset into buf in IO_CHUNK_BYTES pieces from all threads.*/
+inline bool parallel_pread(int fd, char* buf, std::size_t size, std::size_t offset) {
+    std::atomic<bool> ok(true);
+    parallel_for_chunks(size, IO_CHUNK_BYTES, [&](std::size_t b, std::size_t e, std::size_t) {
+        while(b < e) {
+            ssize_t n = ::pread(fd, buf + b, e - b, offset + b);
+            if(n <= 0) {
+                ok = false;
+                return;
+            }
+            b += n;
+        }
+    });
+    return ok;
+}
+
+template<typename Index>
+bool write_edge_list_text(const std::string& path, const EdgeList<Index>& edges) {
+    FILE* f = std::fopen(path.c_str(), "w");
+    if(!f)
+        return false;
+    for(const auto& e : edges)
+        std::fprintf(f, "%llu %llu\n", (unsigned long long)e.first, (unsigned long long)e.second);
+    return std::fclose(f) == 0;
+}
+
+template<typename Index>
+bool write_edge_list_binary(const std::string& path, const EdgeList<Index>& edges) {
+    static_assert(sizeof(typename EdgeList<Index>::value_type) == 2 * sizeof(Index),
+                  "EdgeList must be tightly packed pairs");
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if(!f)
+        return false;
+    EdgeListHeader h;
+    std::memcpy(h.magic_, EDGELIST_MAGIC, sizeof(h.magic_));
+    h.version_ = EDGELIST_VERSION;
+    h.index_bytes_ = sizeof(Index);
+    h.edge_count_ = edges.size();
+    bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1
+        && std::fwrite(edges.data(), sizeof(edges[0]), edges.size(), f) == edges.size();
+    return (std::fclose(f) == 0) && ok;
+}
+
+template<typename Index>
+bool load_edge_list_binary(const std::string& path, EdgeList<Index>& edges) {
+    edges.clear();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        return false;
+    EdgeListHeader h;
+    struct stat st;
+    bool ok = ::fstat(fd, &st) == 0
+        && ::pread(fd, &h, sizeof(h), 0) == ssize_t(sizeof(h))
+        && std::memcmp(h.magic_, EDGELIST_MAGIC, sizeof(h.magic_)) == 0
+        && h.version_ == EDGELIST_VERSION
+        && h.index_bytes_ == sizeof(Index);
+    /*the edges must fill the rest of the file exactly, a truncated or corrupt
+      file is rejected before anything is allocated (divided, not multiplied,
+      so a huge edge_count_ can not overflow)*/
+    if(ok) {
+        const std::uint64_t payload = std::uint64_t(st.st_size) - sizeof(h);
+        ok = payload % sizeof(edges[0]) == 0 && payload / sizeof(edges[0]) == h.edge_count_;
+    }
+    if(ok) {
+        edges.resize(h.edge_count_);
+        ok = parallel_pread(fd, reinterpret_cast<char*>(edges.data()),
+                            h.edge_count_ * sizeof(edges[0]), sizeof(h));
+    }
+    ::close(fd);
+    if(!ok)
+        edges.clear();
+    return ok;
+}
+
+/*Parses the complete lines of [b, e) into out. Returns false on a malformed line.*/
+template<typename Index>
+bool parse_edge_lines(const char* b, const char* e, EdgeList<Index>& out) {
+    auto skip_blank = [&]() { while(b < e && (*b == ' ' || *b == '\t' || *b == '\r')) ++b; };
+    auto number = [&](Index& v) {
+        if(b == e || *b < '0' || *b > '9')
+            return false;
+        std::uint64_t x = 0;
+        while(b < e && *b >= '0' && *b <= '9')
+            x = x * 10 + (*b++ - '0');
+        v = Index(x);
+        return true;
+    };
+    while(b < e) {
+        skip_blank();
+        if(b < e && (*b == '#' || *b == '%' || *b == '\n')) {
+            const char* nl = static_cast<const char*>(std::memchr(b, '\n', e - b));
+            b = nl ? nl + 1 : e;
+            continue;
+        }
+        if(b == e)
+            break;
+        Index u, v;
+        if(!number(u))
+            return false;
+        skip_blank();
+        if(!number(v))
+            return false;
+        out.push_back({ u, v });
+        skip_blank();
+        if(b < e && *b != '\n')
+            return false;
+        if(b < e)
+            ++b;
+    }
+    return true;
+}
+
+template<typename Index>
+bool load_edge_list_text(const std::string& path, EdgeList<Index>& edges) {
+    edges.clear();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        return false;
+    struct stat st;
+    if(::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    std::vector<char> text(st.st_size);
+    bool ok = parallel_pread(fd, text.data(), text.size(), 0);
+    ::close(fd);
+    if(!ok)
+        return false;
+
+    const std::size_t parts = std::max(1u, std::thread::hardware_concurrency());
+    const char* const begin = text.data();
+    const char* const end = begin + text.size();
+    /*part p is [start[p], start[p+1]), every start but the first moved past a newline*/
+    std::vector<const char*> start(parts + 1, end);
+    start[0] = begin;
+    for(std::size_t p = 1; p < parts; ++p) {
+        const char* s = std::max(start[p - 1], begin + text.size() * p / parts);
+        if(s > begin && s < end && s[-1] != '\n') {
+            const char* nl = static_cast<const char*>(std::memchr(s, '\n', end - s));
+            s = nl ? nl + 1 : end;
+        }
+        start[p] = s;
+    }
+    std::vector<EdgeList<Index>> part_edges(parts);
+    std::vector<char> part_ok(parts, 1);
+    parallel_for_chunks(parts, 1, [&](std::size_t p, std::size_t, std::size_t) {
+        part_edges[p].reserve((start[p + 1] - start[p]) / 8);
+        part_ok[p] = parse_edge_lines(start[p], start[p + 1], part_edges[p]);
+    });
+    if(std::find(part_ok.begin(), part_ok.end(), 0) != part_ok.end())
+        return false;
+
+    std::vector<std::size_t> offset(parts + 1, 0);
+    for(std::size_t p = 0; p < parts; ++p)
+        offset[p + 1] = offset[p] + part_edges[p].size();
+    edges.resize(offset[parts]);
+    parallel_for_chunks(parts, 1, [&](std::size_t p, std::size_t, std::size_t) {
+        std::copy(part_edges[p].begin(), part_edges[p].end(), edges.begin() + offset[p]);
+    });
+    return true;
+}
+
+#endif
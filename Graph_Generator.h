@@ -0,0 +1,215 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* In process generators of synthetic directed graphs, as edge lists which can be
+* turned into any of the graph forms (eg. make_csr in Graph_CSR.h).
+* The hard coded 100 node tables fit in L1, these can produce graphs of hundreds
+* of millions of edges so that a traversal really works out of memory.
+*
+* erdos_renyi : G(n, m), m edges with uniformly random end points.
+* rmat        : R-MAT / Kronecker graph of 2^scale nodes (Graph500 style a, b, c),
+*               skewed degrees and community like structure.
+* power_law   : Chung-Lu graph, expected degree of node i proportional to
+*               i^(-1/(gamma-1)).
+* grid        : 2D grid, every node connected to its 4 neighbours both ways.
+*               Large diameter, traversal goes very deep.
+* chain       : 0 -> 1 -> ... -> n-1, the worst case for recursion depth.
+*
+* The random generators work on chunks of CHUNK_EDGES edges. Every chunk has its
+* own generator seeded from (seed, chunk number), so the chunks are generated in
+* parallel and the output depends only on the seed, not on the thread count.
+* Node ids of rmat and power_law are scrambled with a seeded permutation, otherwise
+* the high degree nodes would all sit at the low ids and the layout would be
+* unrealistically cache friendly.
+******/
+#ifndef GRAPH_GENERATOR_H
+#define GRAPH_GENERATOR_H
+
+#include<algorithm>
+#include<atomic>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+#include<numeric>
+#include<random>
+#include<thread>
+#include<vector>
+#include "Graph_CSR.h"
+
+constexpr static std::size_t CHUNK_EDGES = 1 << 20;
+
+/*Runs fn(begin, end, chunk) over [0, count) in chunks of chunk_size,
+  spread over max_threads threads (0: all hardware threads).*/
+template<typename Fn>
+void parallel_for_chunks(std::size_t count, std::size_t chunk_size, Fn fn, unsigned max_threads = 0) {
+    const std::size_t chunks = (count + chunk_size - 1) / chunk_size;
+    const std::size_t threads = std::min<std::size_t>(
+        max_threads ? max_threads : std::max(1u, std::thread::hardware_concurrency()), chunks);
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for(std::size_t c = next++; c < chunks; c = next++)
+            fn(c * chunk_size, std::min(count, (c + 1) * chunk_size), c);
+    };
+    std::vector<std::thread> pool;
+    for(std::size_t t = 1; t < threads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for(auto& t : pool)
+        t.join();
+}
+
+/*splitmix64 finalizer, decorrelates the seeds of neighbouring chunks.*/
+inline std::uint64_t chunk_seed(std::uint64_t seed, std::uint64_t chunk) {
+    std::uint64_t z = seed + (chunk + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/*Relabels the nodes of edges with a seeded random permutation of [0, n).*/
+template<typename Index>
+void scramble_ids(EdgeList<Index>& edges, std::size_t n, std::uint64_t seed) {
+    std::vector<Index> perm(n);
+    std::iota(perm.begin(), perm.end(), Index(0));
+    std::shuffle(perm.begin(), perm.end(), std::mt19937_64(seed));
+    parallel_for_chunks(edges.size(), CHUNK_EDGES, [&](std::size_t b, std::size_t e, std::size_t) {
+        for(std::size_t i = b; i < e; ++i)
+            edges[i] = { perm[edges[i].first], perm[edges[i].second] };
+    });
+}
+
+template<typename Index>
+EdgeList<Index> erdos_renyi(std::size_t n, std::size_t m, std::uint64_t seed) {
+    EdgeList<Index> edges(m);
+    parallel_for_chunks(m, CHUNK_EDGES, [&](std::size_t b, std::size_t e, std::size_t c) {
+        std::mt19937_64 gen(chunk_seed(seed, c));
+        std::uniform_int_distribution<std::uint64_t> pick(0, n - 1);
+        for(std::size_t i = b; i < e; ++i)
+            edges[i] = { Index(pick(gen)), Index(pick(gen)) };
+    });
+    return edges;
+}
+
+template<typename Index>
+EdgeList<Index> rmat(unsigned scale, std::size_t m, std::uint64_t seed,
+                     double a = 0.57, double b = 0.19, double c = 0.19) {
+    EdgeList<Index> edges(m);
+    parallel_for_chunks(m, CHUNK_EDGES, [&](std::size_t first, std::size_t last, std::size_t chunk) {
+        std::mt19937_64 gen(chunk_seed(seed, chunk));
+        std::uniform_real_distribution<double> coin(0.0, 1.0);
+        for(std::size_t i = first; i < last; ++i) {
+            std::uint64_t u = 0, v = 0;
+            for(unsigned level = 0; level < scale; ++level) {
+                double r = coin(gen);
+                u <<= 1;
+                v <<= 1;
+                /*quadrants a, b, c, d are (0,0), (0,1), (1,0), (1,1)*/
+                if(r >= a + b)
+                    u |= 1;
+                if((r >= a && r < a + b) || r >= a + b + c)
+                    v |= 1;
+            }
+            edges[i] = { Index(u), Index(v) };
+        }
+    });
+    scramble_ids(edges, std::size_t(1) << scale, seed);
+    return edges;
+}
+
+template<typename Index>
+EdgeList<Index> power_law(std::size_t n, std::size_t m, std::uint64_t seed, double gamma = 2.5) {
+    /*cumulative weights, sampling a node is a binary search for a uniform value*/
+    std::vector<double> cumulative(n);
+    double sum = 0;
+    const double exponent = -1.0 / (gamma - 1.0);
+    for(std::size_t i = 0; i < n; ++i) {
+        sum += std::pow(double(i + 1), exponent);
+        cumulative[i] = sum;
+    }
+    EdgeList<Index> edges(m);
+    parallel_for_chunks(m, CHUNK_EDGES, [&](std::size_t b, std::size_t e, std::size_t c) {
+        std::mt19937_64 gen(chunk_seed(seed, c));
+        std::uniform_real_distribution<double> pick(0.0, sum);
+        auto sample = [&]() {
+            auto it = std::upper_bound(cumulative.begin(), cumulative.end(), pick(gen));
+            return Index(std::min<std::size_t>(it - cumulative.begin(), n - 1));
+        };
+        for(std::size_t i = b; i < e; ++i) {
+            Index u = sample();
+            edges[i] = { u, sample() };
+        }
+    });
+    scramble_ids(edges, n, seed);
+    return edges;
+}
+
+template<typename Index>
+EdgeList<Index> grid(std::size_t rows, std::size_t cols) {
+    EdgeList<Index> edges;
+    edges.reserve(4 * rows * cols);
+    for(std::size_t r = 0; r < rows; ++r) {
+        for(std::size_t c = 0; c < cols; ++c) {
+            Index node = Index(r * cols + c);
+            if(c + 1 < cols) {
+                edges.push_back({ node, Index(node + 1) });
+                edges.push_back({ Index(node + 1), node });
+            }
+            if(r + 1 < rows) {
+                edges.push_back({ node, Index(node + cols) });
+                edges.push_back({ Index(node + cols), node });
+            }
+        }
+    }
+    return edges;
+}
+
+template<typename Index>
+EdgeList<Index> chain(std::size_t n) {
+    EdgeList<Index> edges;
+    edges.reserve(n);
+    for(std::size_t i = 0; i + 1 < n; ++i)
+        edges.push_back({ Index(i), Index(i + 1) });
+    return edges;
+}
+
+enum GraphTopology {ERDOS_RENYI = 0, RMAT = 1, POWER_LAW = 2, GRID = 3, CHAIN = 4};
+
+/*One entry point for the benchmarks. Graphs of about node_count nodes and
+  avg_degree * node_count edges (rmat rounds node_count up to a power of two,
+  grid down to a square, grid and chain have their own fixed degree).
+  *actual_nodes receives the real node count.*/
+template<typename Index>
+EdgeList<Index> generate_graph(GraphTopology topology, std::size_t node_count,
+                               std::size_t avg_degree, std::uint64_t seed,
+                               std::size_t* actual_nodes) {
+    const std::size_t m = node_count * avg_degree;
+    if(topology == GraphTopology::ERDOS_RENYI) {
+        *actual_nodes = node_count;
+        return erdos_renyi<Index>(node_count, m, seed);
+    }
+    else if(topology == GraphTopology::RMAT) {
+        unsigned scale = 0;
+        while((std::size_t(1) << scale) < node_count)
+            ++scale;
+        *actual_nodes = std::size_t(1) << scale;
+        return rmat<Index>(scale, m, seed);
+    }
+    else if(topology == GraphTopology::POWER_LAW) {
+        *actual_nodes = node_count;
+        return power_law<Index>(node_count, m, seed);
+    }
+    else if(topology == GraphTopology::GRID) {
+        std::size_t side = static_cast<std::size_t>(std::sqrt(double(node_count)));
+        *actual_nodes = side * side;
+        return grid<Index>(side, side);
+    }
+    else {
+        *actual_nodes = node_count;
+        return chain<Index>(node_count);
+    }
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* Reachability from a fixed root while edges keep being added.
+* Inserting edges only ever grows the reachable set, and a node which is already
+* reachable stays reachable, so nothing found before has to be looked at again.
+* An insert u -> v matters only if u is reachable and v is not, then the new part
+* of the set is exactly what v reaches through unvisited nodes, a DFS from v which
+* stops at visited nodes. Over any stream of inserts every node is explored at most
+* once and every edge is followed at most once after its source is reached, the
+* total work is that of a single traversal of the final graph.
+*
+* dynamic_graph : adjacency lists which take insertions, usable by DFA_iterative
+*                 (node_type and neighbors()).
+* incremental_reachability : owns the reachable set of one root over a
+*                 dynamic_graph. insert(edges) adds a batch of edges to the graph
+*                 first and then explores from every edge which crosses from the
+*                 reachable set to the rest, in one DFS, so an edge of the batch
+*                 which leaves a node reached by the same batch is found without
+*                 a second pass. last_reached() lists the nodes the batch added.
+******/
+#ifndef GRAPH_INCREMENTAL_H
+#define GRAPH_INCREMENTAL_H
+
+#include<cstddef>
+#include<utility>
+#include<vector>
+#include "Graph_CSR.h"
+#include "Graph_VisitedSet.h"
+
+template<typename Index>
+class dynamic_graph {
+    std::vector<std::vector<Index>> adjacency_;
+public:
+    typedef Index node_type;
+
+    explicit dynamic_graph(std::size_t node_count) : adjacency_(node_count) {}
+    dynamic_graph(const EdgeList<Index>& edges, std::size_t node_count) : adjacency_(node_count) {
+        for(const auto& e : edges)
+            adjacency_[e.first].push_back(e.second);
+    }
+    void add_edge(Index u, Index v) { adjacency_[u].push_back(v); }
+    const std::vector<Index>& neighbors(Index node) const { return adjacency_[node]; }
+    std::size_t node_count() const { return adjacency_.size(); }
+};
+
+template<typename Index>
+class incremental_reachability {
+    dynamic_graph<Index>& g_;
+    Index root_;
+    bitmap_visited visited_;
+    std::size_t count_ = 0;
+    std::vector<Index> stack_;
+    std::vector<Index> last_reached_;
+
+    /*DFA_iterative from the nodes on stack_, visited nodes are the boundary*/
+    void explore() {
+        while(!stack_.empty()) {
+            Index node = stack_.back();
+            stack_.pop_back();
+            if(visited_.test(node))
+                continue;
+            visited_.set(node);
+            ++count_;
+            last_reached_.push_back(node);
+            for(auto i : g_.neighbors(node))
+                if(!visited_.test(i))
+                    stack_.push_back(i);
+        }
+    }
+public:
+    /*Traverses g once from root to get the initial set.*/
+    incremental_reachability(dynamic_graph<Index>& g, Index root)
+        : g_(g), root_(root), visited_(g.node_count()) {
+        stack_.push_back(root);
+        explore();
+    }
+    void insert(Index u, Index v) {
+        last_reached_.clear();
+        g_.add_edge(u, v);
+        if(visited_.test(u) && !visited_.test(v)) {
+            stack_.push_back(v);
+            explore();
+        }
+    }
+    void insert(const EdgeList<Index>& edges) {
+        last_reached_.clear();
+        for(const auto& e : edges)
+            g_.add_edge(e.first, e.second);
+        for(const auto& e : edges)
+            if(visited_.test(e.first) && !visited_.test(e.second))
+                stack_.push_back(e.second);
+        explore();
+    }
+    bool reachable(Index node) const { return visited_.test(node); }
+    std::size_t count() const { return count_; }
+    Index root() const { return root_; }
+    /*Nodes which became reachable by the last insert, in discovery order.*/
+    const std::vector<Index>& last_reached() const { return last_reached_; }
+};
+
+#endif
@@ -0,0 +1,207 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* A binary file which is a CSR graph, so it can be mmap-ed and traversed in place.
+* Layout (little endian, as in memory):
+*     GraphFileHeader, padded to GRAPH_FILE_ALIGN bytes
+*     offsets   : node_count + 1 Index values, padded to GRAPH_FILE_ALIGN
+*     neighbors : edge_count Index values
+* Both arrays start on a page boundary, so the mapped arrays are aligned for any
+* Index and can be read through the same neighbor_range as CSRGraph.
+*
+* write_graph_file writes any graph with neighbors() (Graph, CSRGraph,
+* dynamic_graph, ...), node_count is passed as Graph and CSRGraph disagree on it.
+* It returns false, without creating the file, when node_count or the number of
+* edges does not fit in Index.
+* MappedGraph maps a file read only. Only the offsets are read when it is opened
+* (to validate them), the neighbour pages are faulted in by the traversal itself,
+* unless a hint asks otherwise:
+*   HINT_POPULATE : MAP_POPULATE, the whole file is read in by mmap.
+*   HINT_WILLNEED : madvise(MADV_WILLNEED), asynchronous read ahead of the file.
+*   HINT_RANDOM   : madvise(MADV_RANDOM), no read around on faults, for traversals
+*                   over a file larger than memory.
+*   HINT_HUGEPAGE : madvise(MADV_HUGEPAGE), only has an effect if the page cache
+*                   supports huge pages for the file system.
+* open() returns false when the file can not be mapped or is not a graph file of
+* this version and Index width, or when its arrays do not fit in the file or the
+* offsets are not monotonic up to edge_count. The check reads the offsets once.
+* Linux/POSIX only.
+******/
+#ifndef GRAPH_MAPPEDFILE_H
+#define GRAPH_MAPPEDFILE_H
+
+#include<cstdint>
+#include<cstdio>
+#include<cstring>
+#include<string>
+#include<vector>
+#include<fcntl.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#include "Graph_CSR.h"
+
+struct GraphFileHeader {
+    char magic_[8];
+    std::uint32_t version_;
+    std::uint32_t index_bytes_;
+    std::uint64_t node_count_;
+    std::uint64_t edge_count_;
+    std::uint64_t offsets_pos_;
+    std::uint64_t neighbors_pos_;
+};
+constexpr static char GRAPHFILE_MAGIC[8] = {'S','P','G','R','A','P','H','\0'};
+constexpr static std::uint32_t GRAPHFILE_VERSION = 1;
+constexpr static std::uint64_t GRAPH_FILE_ALIGN = 4096;
+
+enum MappedGraphHint {HINT_NONE = 0, HINT_POPULATE = 1, HINT_WILLNEED = 2, HINT_RANDOM = 4, HINT_HUGEPAGE = 8};
+
+inline std::uint64_t graph_file_align(std::uint64_t pos) {
+    return (pos + GRAPH_FILE_ALIGN - 1) / GRAPH_FILE_ALIGN * GRAPH_FILE_ALIGN;
+}
+
+template<typename Index, typename G>
+bool write_graph_file(const std::string& path, const G& g, std::size_t node_count) {
+    /*the node ids and every offset have to fit in Index, checked before the
+      file is created*/
+    if(std::uint64_t(Index(node_count)) != node_count)
+        return false;
+    std::vector<Index> offsets;
+    offsets.reserve(node_count + 1);
+    offsets.push_back(0);
+    std::uint64_t edges = 0;
+    for(std::size_t u = 0; u < node_count; ++u) {
+        for(auto v : g.neighbors(typename G::node_type(u))) {
+            (void)v;
+            ++edges;
+        }
+        if(std::uint64_t(Index(edges)) != edges)
+            return false;
+        offsets.push_back(Index(edges));
+    }
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if(!f)
+        return false;
+    GraphFileHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic_, GRAPHFILE_MAGIC, sizeof(h.magic_));
+    h.version_ = GRAPHFILE_VERSION;
+    h.index_bytes_ = sizeof(Index);
+    h.node_count_ = node_count;
+    h.edge_count_ = edges;
+    h.offsets_pos_ = graph_file_align(sizeof(h));
+    h.neighbors_pos_ = graph_file_align(h.offsets_pos_ + offsets.size() * sizeof(Index));
+
+    static const char zeros[GRAPH_FILE_ALIGN] = {};
+    auto pad_to = [&](std::uint64_t pos) {
+        long at = std::ftell(f);
+        return at >= 0 && std::fwrite(zeros, 1, pos - at, f) == pos - at;
+    };
+    bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1
+        && pad_to(h.offsets_pos_)
+        && std::fwrite(offsets.data(), sizeof(Index), offsets.size(), f) == offsets.size()
+        && pad_to(h.neighbors_pos_);
+    std::vector<Index> list;
+    for(std::size_t u = 0; ok && u < node_count; ++u) {
+        list.clear();
+        for(auto v : g.neighbors(typename G::node_type(u)))
+            list.push_back(Index(v));
+        ok = std::fwrite(list.data(), sizeof(Index), list.size(), f) == list.size();
+    }
+    return (std::fclose(f) == 0) && ok;
+}
+
+template<typename Index>
+class MappedGraph {
+    void* base_ = nullptr;
+    std::size_t size_ = 0;
+    const Index* offsets_ = nullptr;
+    const Index* neighbors_ = nullptr;
+    std::size_t node_count_ = 0;
+    std::size_t edge_count_ = 0;
+
+    /*Number of Index values in [pos, end), 0 if pos is past end. Divides
+      instead of multiplying the counts of a header which may be corrupt.*/
+    static std::uint64_t fitting(std::uint64_t pos, std::uint64_t end) {
+        return pos <= end ? (end - pos) / sizeof(Index) : 0;
+    }
+public:
+    typedef Index node_type;
+    typedef typename CSRGraph<Index>::neighbor_range neighbor_range;
+
+    MappedGraph() = default;
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+    ~MappedGraph() { close(); }
+
+    bool open(const std::string& path, unsigned hints = HINT_NONE) {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            return false;
+        struct stat st;
+        if(::fstat(fd, &st) != 0 || std::size_t(st.st_size) < sizeof(GraphFileHeader)) {
+            ::close(fd);
+            return false;
+        }
+        const int flags = MAP_SHARED | (hints & HINT_POPULATE ? MAP_POPULATE : 0);
+        void* base = ::mmap(nullptr, st.st_size, PROT_READ, flags, fd, 0);
+        ::close(fd);
+        if(base == MAP_FAILED)
+            return false;
+        base_ = base;
+        size_ = st.st_size;
+        /*before the offsets are validated, so that reading them follows the hints*/
+        if(hints & HINT_WILLNEED)
+            ::madvise(base_, size_, MADV_WILLNEED);
+        if(hints & HINT_RANDOM)
+            ::madvise(base_, size_, MADV_RANDOM);
+        if(hints & HINT_HUGEPAGE)
+            ::madvise(base_, size_, MADV_HUGEPAGE);
+
+        const GraphFileHeader& h = *static_cast<const GraphFileHeader*>(base_);
+        bool ok = std::memcmp(h.magic_, GRAPHFILE_MAGIC, sizeof(h.magic_)) == 0
+            && h.version_ == GRAPHFILE_VERSION
+            && h.index_bytes_ == sizeof(Index)
+            && h.offsets_pos_ % GRAPH_FILE_ALIGN == 0 && h.neighbors_pos_ % GRAPH_FILE_ALIGN == 0
+            && h.node_count_ < fitting(h.offsets_pos_, h.neighbors_pos_)
+            && h.edge_count_ <= fitting(h.neighbors_pos_, size_);
+        if(ok) {
+            /*every neighbors() range has to be inside the neighbor array*/
+            const Index* offsets = reinterpret_cast<const Index*>(static_cast<const char*>(base_) + h.offsets_pos_);
+            ok = offsets[0] == 0 && offsets[h.node_count_] == h.edge_count_;
+            for(std::uint64_t u = 0; ok && u < h.node_count_; ++u)
+                ok = offsets[u] <= offsets[u + 1];
+        }
+        if(!ok) {
+            close();
+            return false;
+        }
+        const char* bytes = static_cast<const char*>(base_);
+        offsets_ = reinterpret_cast<const Index*>(bytes + h.offsets_pos_);
+        neighbors_ = reinterpret_cast<const Index*>(bytes + h.neighbors_pos_);
+        node_count_ = h.node_count_;
+        edge_count_ = h.edge_count_;
+        return true;
+    }
+    void close() {
+        if(base_)
+            ::munmap(base_, size_);
+        base_ = nullptr;
+        size_ = 0;
+        offsets_ = neighbors_ = nullptr;
+        node_count_ = edge_count_ = 0;
+    }
+
+    std::size_t node_count() const { return node_count_; }
+    std::size_t edge_count() const { return edge_count_; }
+    std::size_t degree(Index node) const { return offsets_[node + 1] - offsets_[node]; }
+    neighbor_range neighbors(Index node) const {
+        return { neighbors_ + offsets_[node], neighbors_ + offsets_[node + 1] };
+    }
+};
+
+#endif
@@ -0,0 +1,230 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* Node relabelling passes. In a random graph the neighbours of a node are spread
+* over the whole id space, so on a large graph every edge followed is a cache miss
+* in the visited store and in offsets_. A relabelling which gives nearby ids to
+* nodes which are visited close in time turns part of those into hits.
+*
+* bfs_order       : ids in BFS discovery order from a root (then from every node
+*                   not reached yet).
+* rcm_order       : Reverse Cuthill-McKee on the undirected view, BFS from a low
+*                   degree node visiting neighbours by increasing degree, reversed.
+*                   Minimizes the bandwidth of the adjacency matrix.
+* degree_order    : by decreasing degree, the hubs share a few cache lines.
+* community_order : a light Rabbit-order/Gorder style pass. Communities are found
+*                   with a few rounds of label propagation on the undirected view,
+*                   nodes of one community get consecutive ids (BFS order inside
+*                   the community).
+*
+* Every pass returns a NodeOrder holding both directions of the permutation, so
+* results can be mapped back to the original ids. relabel() builds the reordered
+* CSR graph with sorted neighbour lists.
+******/
+#ifndef GRAPH_REORDER_H
+#define GRAPH_REORDER_H
+
+#include<algorithm>
+#include<cstddef>
+#include<cstdint>
+#include<numeric>
+#include<vector>
+#include "Graph_CSR.h"
+
+template<typename Index>
+struct NodeOrder {
+    std::vector<Index> new_id_;  // new_id_[original id]
+    std::vector<Index> old_id_;  // old_id_[new id]
+};
+
+/*Builds both directions of the permutation from the list of original ids
+  in their new order.*/
+template<typename Index>
+NodeOrder<Index> make_order(std::vector<Index> old_id) {
+    NodeOrder<Index> order;
+    order.new_id_.resize(old_id.size());
+    for(std::size_t i = 0; i < old_id.size(); ++i)
+        order.new_id_[old_id[i]] = Index(i);
+    order.old_id_ = std::move(old_id);
+    return order;
+}
+
+template<typename Index>
+NodeOrder<Index> identity_order(const CSRGraph<Index>& G) {
+    std::vector<Index> ids(G.node_count());
+    std::iota(ids.begin(), ids.end(), Index(0));
+    return make_order(std::move(ids));
+}
+
+template<typename Index>
+NodeOrder<Index> bfs_order(const CSRGraph<Index>& G, Index root) {
+    const std::size_t n = G.node_count();
+    std::vector<Index> ids;
+    ids.reserve(n);
+    std::vector<char> seen(n, 0);
+    auto bfs = [&](Index start) {
+        std::size_t head = ids.size();
+        seen[start] = 1;
+        ids.push_back(start);
+        while(head < ids.size()) {
+            Index u = ids[head++];
+            for(auto v : G.neighbors(u)) {
+                if(!seen[v]) {
+                    seen[v] = 1;
+                    ids.push_back(v);
+                }
+            }
+        }
+    };
+    bfs(root);
+    for(std::size_t v = 0; v < n; ++v)
+        if(!seen[v])
+            bfs(Index(v));
+    return make_order(std::move(ids));
+}
+
+template<typename Index>
+NodeOrder<Index> rcm_order(const CSRGraph<Index>& G) {
+    const std::size_t n = G.node_count();
+    const CSRGraph<Index> T = transpose(G);
+    auto degree = [&](Index v) { return G.degree(v) + T.degree(v); };
+    /*start nodes are tried from the lowest degree up, as Cuthill-McKee suggests*/
+    std::vector<Index> by_degree(n);
+    std::iota(by_degree.begin(), by_degree.end(), Index(0));
+    std::stable_sort(by_degree.begin(), by_degree.end(),
+                     [&](Index a, Index b) { return degree(a) < degree(b); });
+    std::vector<Index> ids;
+    ids.reserve(n);
+    std::vector<char> seen(n, 0);
+    std::vector<Index> level;
+    for(auto start : by_degree) {
+        if(seen[start])
+            continue;
+        std::size_t head = ids.size();
+        seen[start] = 1;
+        ids.push_back(start);
+        while(head < ids.size()) {
+            Index u = ids[head++];
+            level.clear();
+            for(auto v : G.neighbors(u)) {
+                if(!seen[v]) {
+                    seen[v] = 1;
+                    level.push_back(v);
+                }
+            }
+            for(auto v : T.neighbors(u)) {
+                if(!seen[v]) {
+                    seen[v] = 1;
+                    level.push_back(v);
+                }
+            }
+            std::sort(level.begin(), level.end(),
+                      [&](Index a, Index b) { return degree(a) < degree(b); });
+            ids.insert(ids.end(), level.begin(), level.end());
+        }
+    }
+    std::reverse(ids.begin(), ids.end());
+    return make_order(std::move(ids));
+}
+
+template<typename Index>
+NodeOrder<Index> degree_order(const CSRGraph<Index>& G) {
+    std::vector<Index> ids(G.node_count());
+    std::iota(ids.begin(), ids.end(), Index(0));
+    std::stable_sort(ids.begin(), ids.end(),
+                     [&](Index a, Index b) { return G.degree(a) > G.degree(b); });
+    return make_order(std::move(ids));
+}
+
+/*rounds of label propagation, every node takes the most frequent label of
+  its neighbours (ties keep the smaller label). Labels are updated in place
+  so a round sees the labels already changed in it, which converges faster.*/
+template<typename Index>
+NodeOrder<Index> community_order(const CSRGraph<Index>& G, unsigned rounds = 5) {
+    const std::size_t n = G.node_count();
+    const CSRGraph<Index> T = transpose(G);
+    std::vector<Index> label(n);
+    std::iota(label.begin(), label.end(), Index(0));
+    std::vector<Index> seen;
+    for(unsigned r = 0; r < rounds; ++r) {
+        bool changed = false;
+        for(std::size_t v = 0; v < n; ++v) {
+            seen.clear();
+            for(auto u : G.neighbors(Index(v)))
+                seen.push_back(label[u]);
+            for(auto u : T.neighbors(Index(v)))
+                seen.push_back(label[u]);
+            if(seen.empty())
+                continue;
+            std::sort(seen.begin(), seen.end());
+            Index best = seen[0];
+            std::size_t best_count = 0;
+            for(std::size_t i = 0; i < seen.size(); ) {
+                std::size_t j = i;
+                while(j < seen.size() && seen[j] == seen[i])
+                    ++j;
+                if(j - i > best_count) {
+                    best_count = j - i;
+                    best = seen[i];
+                }
+                i = j;
+            }
+            if(best != label[v]) {
+                label[v] = best;
+                changed = true;
+            }
+        }
+        if(!changed)
+            break;
+    }
+    /*communities in order of their label, members in BFS order so that
+      neighbours inside a community are also close*/
+    const NodeOrder<Index> bfs = bfs_order(G, Index(0));
+    std::vector<Index> ids(n);
+    std::iota(ids.begin(), ids.end(), Index(0));
+    std::sort(ids.begin(), ids.end(), [&](Index a, Index b) {
+        return label[a] != label[b] ? label[a] < label[b] : bfs.new_id_[a] < bfs.new_id_[b];
+    });
+    return make_order(std::move(ids));
+}
+
+/*G with every node v renamed to order.new_id_[v]. Neighbour lists are
+  sorted so that a node's neighbours are read in increasing id order.*/
+template<typename Index>
+CSRGraph<Index> relabel(const CSRGraph<Index>& G, const NodeOrder<Index>& order) {
+    const std::size_t n = G.node_count();
+    CSRGraph<Index> R;
+    R.offsets_.resize(n + 1);
+    R.offsets_[0] = 0;
+    for(std::size_t i = 0; i < n; ++i)
+        R.offsets_[i + 1] = R.offsets_[i] + Index(G.degree(order.old_id_[i]));
+    R.neighbors_.resize(G.edge_count());
+    for(std::size_t i = 0; i < n; ++i) {
+        Index* out = R.neighbors_.data() + R.offsets_[i];
+        for(auto v : G.neighbors(order.old_id_[i]))
+            *out++ = order.new_id_[v];
+        std::sort(R.neighbors_.data() + R.offsets_[i], out);
+    }
+    return R;
+}
+
+enum ReorderKind {ORIGINAL = 0, BFS_ORDER = 1, RCM_ORDER = 2, DEGREE_ORDER = 3, COMMUNITY_ORDER = 4};
+
+template<typename Index>
+NodeOrder<Index> reorder(const CSRGraph<Index>& G, ReorderKind kind, Index root) {
+    if(kind == ReorderKind::BFS_ORDER)
+        return bfs_order(G, root);
+    else if(kind == ReorderKind::RCM_ORDER)
+        return rcm_order(G);
+    else if(kind == ReorderKind::DEGREE_ORDER)
+        return degree_order(G);
+    else if(kind == ReorderKind::COMMUNITY_ORDER)
+        return community_order(G);
+    else
+        return identity_order(G);
+}
+
+#endif
@@ -0,0 +1,146 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* Alternatives to std::set<int> as the visited store of a graph traversal.
+* A store is built once for a graph of node_count nodes and reset() between
+* traversals, so the cost of rebuilding it is not paid on every iteration.
+* All of them have test(node), set(node) and reset(), which is what the
+* generic is_visited/set_visited in RecursionIteration_DFA.h dispatch to.
+*
+* bitmap_visited  : one bit per node. Smallest dense form, reset is a memset
+*                   of node_count/8 bytes.
+* epoch_visited   : one Stamp per node holding the traversal number which last
+*                   visited it. reset() just bumps the number, the array is only
+*                   cleared when the counter wraps (every 255 resets for uint8_t,
+*                   every 4G for uint32_t).
+* hash_visited    : open addressing hash set. Its size follows the number of
+*                   visited nodes instead of node_count, for huge graphs where
+*                   a traversal only reaches a few nodes.
+* atomic_bitmap_visited : bitmap_visited which can be shared between threads.
+*                   claim(node) is an atomic test-and-set, exactly one thread
+*                   gets true for a node.
+******/
+#ifndef GRAPH_VISITEDSET_H
+#define GRAPH_VISITEDSET_H
+
+#include<algorithm>
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<limits>
+#include<vector>
+
+class bitmap_visited {
+    std::vector<std::uint64_t> bits_;
+public:
+    explicit bitmap_visited(std::size_t node_count) : bits_((node_count + 63) / 64, 0) {}
+    bool test(std::size_t node) const { return (bits_[node >> 6] >> (node & 63)) & 1; }
+    void set(std::size_t node) { bits_[node >> 6] |= std::uint64_t(1) << (node & 63); }
+    void reset() { std::fill(bits_.begin(), bits_.end(), 0); }
+};
+
+class atomic_bitmap_visited {
+    std::vector<std::atomic<std::uint64_t>> bits_;
+public:
+    explicit atomic_bitmap_visited(std::size_t node_count) : bits_((node_count + 63) / 64) { reset(); }
+    bool test(std::size_t node) const {
+        return (bits_[node >> 6].load(std::memory_order_relaxed) >> (node & 63)) & 1;
+    }
+    void set(std::size_t node) {
+        bits_[node >> 6].fetch_or(std::uint64_t(1) << (node & 63), std::memory_order_relaxed);
+    }
+    /*The plain load first avoids a locked instruction (and taking the cache
+      line exclusive) for nodes which are visited already, the common case.*/
+    bool claim(std::size_t node) {
+        const std::uint64_t bit = std::uint64_t(1) << (node & 63);
+        auto& word = bits_[node >> 6];
+        if(word.load(std::memory_order_relaxed) & bit)
+            return false;
+        return !(word.fetch_or(bit, std::memory_order_relaxed) & bit);
+    }
+    void reset() {
+        for(auto& w : bits_)
+            w.store(0, std::memory_order_relaxed);
+    }
+};
+
+template<typename Stamp>
+class epoch_visited {
+    std::vector<Stamp> stamp_;
+    Stamp epoch_ = 1;
+public:
+    explicit epoch_visited(std::size_t node_count) : stamp_(node_count, 0) {}
+    bool test(std::size_t node) const { return stamp_[node] == epoch_; }
+    void set(std::size_t node) { stamp_[node] = epoch_; }
+    void reset() {
+        if(++epoch_ == 0) {
+            std::fill(stamp_.begin(), stamp_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+};
+
+/*Linear probing with a power of two table, kept at most half full.
+  The all ones value of Node marks an empty slot, so it can not be
+  stored. reset() clears the table, which is proportional to the number
+  of nodes visited by the previous traversal and not to node_count.*/
+template<typename Node>
+class hash_visited {
+    constexpr static Node EMPTY = std::numeric_limits<Node>::max();
+    constexpr static std::size_t MIN_CAPACITY = 64;
+    std::vector<Node> slots_;
+    std::size_t size_ = 0;
+    unsigned shift_ = 0;
+
+    std::size_t slot_of(Node node) const {
+        return static_cast<std::size_t>(
+            (static_cast<std::uint64_t>(node) * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+    void rehash(std::size_t capacity) {
+        std::vector<Node> old;
+        old.swap(slots_);
+        slots_.assign(capacity, Node(EMPTY));
+        shift_ = 64;
+        for(std::size_t c = capacity; c > 1; c >>= 1)
+            --shift_;
+        size_ = 0;
+        for(auto n : old)
+            if(n != EMPTY)
+                set(n);
+    }
+public:
+    explicit hash_visited(std::size_t /*node_count*/ = 0) { rehash(MIN_CAPACITY); }
+    bool test(Node node) const {
+        const std::size_t mask = slots_.size() - 1;
+        for(std::size_t i = slot_of(node); ; i = (i + 1) & mask) {
+            if(slots_[i] == node)
+                return true;
+            if(slots_[i] == EMPTY)
+                return false;
+        }
+    }
+    void set(Node node) {
+        if(2 * (size_ + 1) > slots_.size())
+            rehash(2 * slots_.size());
+        const std::size_t mask = slots_.size() - 1;
+        for(std::size_t i = slot_of(node); ; i = (i + 1) & mask) {
+            if(slots_[i] == node)
+                return;
+            if(slots_[i] == EMPTY) {
+                slots_[i] = node;
+                ++size_;
+                return;
+            }
+        }
+    }
+    void reset() {
+        std::fill(slots_.begin(), slots_.end(), Node(EMPTY));
+        size_ = 0;
+    }
+    std::size_t size() const { return size_; }
+};
+
+#endif
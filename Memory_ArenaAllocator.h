@@ -0,0 +1,166 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* A per thread size class allocator for the small blocks node based containers
+* (std::set, std::list, std::deque) allocate all the time, and a standard
+* allocator on top of it: arena_allocator<T> can be given to any container, eg.
+*     std::set<int, std::less<int>, arena_allocator<int>>
+*     std::stack<int, std::deque<int, arena_allocator<int>>>
+*
+* Every thread owns a thread_arena. Blocks up to ARENA_MAX_BLOCK bytes are
+* rounded up to a multiple of ARENA_GRANULE, each size class is carved from its
+* own ARENA_CHUNK byte chunks, aligned to ARENA_CHUNK, whose header names the
+* owning arena. So no size and no lock is needed to free a block:
+*   - freed by the owner : pushed on the owner's plain free list of the class.
+*   - freed by another thread : pushed with a CAS on the owner's remote list of
+*     the class. The owner takes the whole remote list with one exchange when
+*     its own list runs empty, only the owner ever pops, so there is no ABA.
+* Larger blocks go to operator new. Blocks are ARENA_GRANULE aligned, enough for
+* any type which is not over aligned, arena_allocator refuses the others at
+* compile time.
+* Arenas are never freed, a thread which exits hands its arena (with its free
+* lists and any blocks still alive in other threads) back to a global pool and
+* the next new thread adopts it. Chunks are never given back to the system.
+******/
+#ifndef MEMORY_ARENAALLOCATOR_H
+#define MEMORY_ARENAALLOCATOR_H
+
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<cstdlib>
+#include<mutex>
+#include<new>
+#include<vector>
+
+constexpr static std::size_t ARENA_GRANULE = 16;
+constexpr static std::size_t ARENA_MAX_BLOCK = 512;
+constexpr static std::size_t ARENA_CLASSES = ARENA_MAX_BLOCK / ARENA_GRANULE;
+constexpr static std::size_t ARENA_CHUNK = 64 * 1024;
+
+class thread_arena {
+    struct free_block { free_block* next_; };
+    struct alignas(ARENA_GRANULE) chunk_header { thread_arena* owner_; };
+    /*owner's lists are written by the owner only, the remote ones by everybody*/
+    free_block* free_[ARENA_CLASSES] = {};
+    char* bump_[ARENA_CLASSES] = {};
+    char* end_[ARENA_CLASSES] = {};
+    char pad_[64];  // keeps the remote lists off the owner's cache lines
+    std::atomic<free_block*> remote_[ARENA_CLASSES];
+
+    static std::size_t size_class(std::size_t n) { return (n + ARENA_GRANULE - 1) / ARENA_GRANULE - 1; }
+    void* refill(std::size_t c) {
+        if(free_block* b = remote_[c].exchange(nullptr, std::memory_order_acquire)) {
+            free_[c] = b->next_;
+            return b;
+        }
+        const std::size_t block = (c + 1) * ARENA_GRANULE;
+        /*compares sizes, bump_ and end_ are null before the first chunk*/
+        if(std::size_t(end_[c] - bump_[c]) < block) {
+            void* chunk = nullptr;
+            if(::posix_memalign(&chunk, ARENA_CHUNK, ARENA_CHUNK) != 0)
+                throw std::bad_alloc();
+            static_cast<chunk_header*>(chunk)->owner_ = this;
+            bump_[c] = static_cast<char*>(chunk) + sizeof(chunk_header);
+            end_[c] = static_cast<char*>(chunk) + ARENA_CHUNK;
+        }
+        void* p = bump_[c];
+        bump_[c] += block;
+        return p;
+    }
+public:
+    thread_arena() {
+        for(auto& r : remote_)
+            r.store(nullptr, std::memory_order_relaxed);
+    }
+    thread_arena(const thread_arena&) = delete;
+    thread_arena& operator=(const thread_arena&) = delete;
+
+    void* allocate(std::size_t n) {
+        if(n > ARENA_MAX_BLOCK)
+            return ::operator new(n);
+        const std::size_t c = size_class(n);
+        if(free_block* b = free_[c]) {
+            free_[c] = b->next_;
+            return b;
+        }
+        return refill(c);
+    }
+    /*this is the calling thread's arena, p may belong to any arena*/
+    void deallocate(void* p, std::size_t n) {
+        if(n > ARENA_MAX_BLOCK) {
+            ::operator delete(p);
+            return;
+        }
+        const std::size_t c = size_class(n);
+        free_block* b = static_cast<free_block*>(p);
+        const auto* chunk = reinterpret_cast<const chunk_header*>(
+            reinterpret_cast<std::uintptr_t>(p) & ~std::uintptr_t(ARENA_CHUNK - 1));
+        thread_arena* owner = chunk->owner_;
+        if(owner == this) {
+            b->next_ = free_[c];
+            free_[c] = b;
+            return;
+        }
+        free_block* head = owner->remote_[c].load(std::memory_order_relaxed);
+        do {
+            b->next_ = head;
+        } while(!owner->remote_[c].compare_exchange_weak(head, b, std::memory_order_release,
+                                                          std::memory_order_relaxed));
+    }
+};
+
+/*Arenas of exited threads, waiting for the next thread.*/
+class arena_pool {
+    std::mutex m_;
+    std::vector<thread_arena*> idle_;
+public:
+    thread_arena* acquire() {
+        std::lock_guard<std::mutex> lk(m_);
+        if(idle_.empty())
+            return new thread_arena();
+        thread_arena* a = idle_.back();
+        idle_.pop_back();
+        return a;
+    }
+    void release(thread_arena* a) {
+        std::lock_guard<std::mutex> lk(m_);
+        idle_.push_back(a);
+    }
+};
+inline arena_pool& global_arena_pool() {
+    static arena_pool* pool = new arena_pool();  // outlives every thread
+    return *pool;
+}
+
+struct arena_handle {
+    thread_arena* arena_ = global_arena_pool().acquire();
+    ~arena_handle() { global_arena_pool().release(arena_); }
+};
+inline thread_arena& this_thread_arena() {
+    static thread_local arena_handle handle;
+    return *handle.arena_;
+}
+
+/*Blocks are only ARENA_GRANULE aligned, over aligned types can not use it.*/
+template<typename T>
+struct arena_allocator {
+    static_assert(alignof(T) <= ARENA_GRANULE, "arena_allocator blocks are only ARENA_GRANULE aligned");
+    typedef T value_type;
+
+    arena_allocator() = default;
+    template<typename U>
+    arena_allocator(const arena_allocator<U>&) {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(this_thread_arena().allocate(n * sizeof(T))); }
+    void deallocate(T* p, std::size_t n) { this_thread_arena().deallocate(p, n * sizeof(T)); }
+};
+template<typename T, typename U>
+bool operator==(const arena_allocator<T>&, const arena_allocator<U>&) { return true; }
+template<typename T, typename U>
+bool operator!=(const arena_allocator<T>&, const arena_allocator<U>&) { return false; }
+
+#endif
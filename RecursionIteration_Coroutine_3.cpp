@@ -0,0 +1,371 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it.
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+*
+* This is a continuation of RecursionIteration_1.cpp and RecursionIteration_DFA_2.cpp.
+* Here the same two recursions (the halving counter and the DFA) are expressed as
+* C++20 coroutines to see what a coroutine based traversal costs compared to the
+* plain recursive call and the explicit stack.
+*
+* A coroutine frame lives on the heap, so a naive coroutine recursion is the worst of
+* both worlds: a function call plus a dynamic allocation per level. Two things are
+* done to take that away:
+* 1) Frames come from a thread local recycling pool (size-classed free lists). Since
+*    frames are released in LIFO order, after the first traversal the pool serves
+*    every frame and the steady state performs no allocation at all.
+* 2) co_await on a child task and the completion of a child use symmetric transfer
+*    (await_suspend returning a coroutine_handle), so resuming the child or the
+*    parent is a tail call and arbitrarily deep chains do not grow the native stack.
+*
+* Needs -std=c++20.
+******/
+
+#include<coroutine>
+#include<cstddef>
+#include<exception>
+#include<new>
+#include<utility>
+#include<vector>
+#include<set>
+#include <benchmark/benchmark.h>
+#include "RecursionIteration_DFA.h"
+
+/*Recycling pool for coroutine frames. Requests are rounded up to
+  FRAME_GRANULE bytes and each size class keeps an intrusive free list.
+  Anything larger than the biggest class goes straight to operator new.
+  system_allocs_ counts the calls which really reached operator new so
+  that the benchmarks can show the steady state allocates nothing.*/
+class frame_pool {
+    constexpr static std::size_t FRAME_GRANULE = 64;
+    constexpr static std::size_t FRAME_CLASSES = 16;
+    struct free_block { free_block* next; };
+    free_block* free_[FRAME_CLASSES] = {};
+public:
+    std::size_t system_allocs_ = 0;
+    frame_pool() = default;
+    frame_pool(const frame_pool&) = delete;
+    frame_pool& operator=(const frame_pool&) = delete;
+    ~frame_pool() {
+        for(auto head : free_) {
+            while(head) {
+                free_block* next = head->next;
+                ::operator delete(head);
+                head = next;
+            }
+        }
+    }
+    void* allocate(std::size_t n) {
+        std::size_t c = (n - 1) / FRAME_GRANULE;
+        ++system_allocs_;
+        if(c >= FRAME_CLASSES)
+            return ::operator new(n);
+        if(free_block* b = free_[c]) {
+            --system_allocs_;
+            free_[c] = b->next;
+            return b;
+        }
+        return ::operator new((c + 1) * FRAME_GRANULE);
+    }
+    void deallocate(void* p, std::size_t n) {
+        std::size_t c = (n - 1) / FRAME_GRANULE;
+        if(c >= FRAME_CLASSES) {
+            ::operator delete(p);
+            return;
+        }
+        free_block* b = static_cast<free_block*>(p);
+        b->next = free_[c];
+        free_[c] = b;
+    }
+};
+thread_local frame_pool coro_frame_pool;
+
+/*Frame allocation policies for the task below.*/
+struct pooled_frames {
+    static void* allocate(std::size_t n) { return coro_frame_pool.allocate(n); }
+    static void deallocate(void* p, std::size_t n) { coro_frame_pool.deallocate(p, n); }
+};
+struct heap_frames {
+    static void* allocate(std::size_t n) { return ::operator new(n); }
+    static void deallocate(void* p, std::size_t) { ::operator delete(p); }
+};
+
+/*Lazily started task. Awaiting a task records the awaiting coroutine as
+  continuation and transfers to the child, when the child finishes its
+  final_suspend transfers back to the continuation. Both transfers are
+  symmetric so the native stack stays flat however deep the chain is.
+  A top level task is started with run(), its continuation is the noop
+  coroutine which returns control to the caller.*/
+template<typename FrameAlloc>
+class basic_task {
+public:
+    struct promise_type {
+        std::coroutine_handle<> continuation_ = std::noop_coroutine();
+
+        struct final_awaiter {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+                return h.promise().continuation_;
+            }
+            void await_resume() const noexcept {}
+        };
+
+        basic_task get_return_object() noexcept {
+            return basic_task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        final_awaiter final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+
+        static void* operator new(std::size_t n) { return FrameAlloc::allocate(n); }
+        static void operator delete(void* p, std::size_t n) { FrameAlloc::deallocate(p, n); }
+    };
+
+    basic_task(basic_task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    basic_task(const basic_task&) = delete;
+    basic_task& operator=(const basic_task&) = delete;
+    ~basic_task() {
+        if(handle_)
+            handle_.destroy();
+    }
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation_ = awaiting;
+        return handle_;
+    }
+    void await_resume() const noexcept {}
+
+    void run() { handle_.resume(); }
+
+private:
+    explicit basic_task(std::coroutine_handle<promise_type> h) noexcept : handle_(h) {}
+    std::coroutine_handle<promise_type> handle_;
+};
+using task = basic_task<pooled_frames>;
+using heap_task = basic_task<heap_frames>;
+
+/*recursive implementation of counting function, same as in
+  RecursionIteration_1.cpp. Used as the baseline.*/
+void recursive(int num, int& result) {
+    if(num == 0)
+        return;
+    ++result;
+    recursive(num/2, result);
+    recursive(num/2, result);
+}
+
+/*Coroutine version of the counting function.*/
+template<typename Task>
+Task coro_recursive(int num, int& result) {
+    if(num == 0)
+        co_return;
+    ++result;
+    co_await coro_recursive<Task>(num/2, result);
+    co_await coro_recursive<Task>(num/2, result);
+}
+
+/*Coroutine version of DFA_recursive.*/
+template<typename Task>
+Task coro_DFA_recursive(Graph& G, int root, std::set<int>& store, int& count) {
+    if(is_visited(root, store))
+        co_return;
+    set_visited(root, store);
+    ++count;
+    for(auto i : G.adjecency_list_[root]) {
+        co_await coro_DFA_recursive<Task>(G, i, store, count);
+    }
+}
+
+/*A chain of depth num. As a plain recursion this would need num native
+  stack frames, with symmetric transfer it runs in constant native stack.*/
+template<typename Task>
+Task coro_chain(int num, int& result) {
+    if(num == 0)
+        co_return;
+    ++result;
+    co_await coro_chain<Task>(num - 1, result);
+}
+
+/*Number of frames per iteration which were not served from the pool.
+  The pooled benchmarks run one traversal before the timed loop so the
+  pool is warm and this shows the steady state.*/
+static void report_frame_allocs(benchmark::State& state, std::size_t before) {
+    state.counters["frame_allocs"] = benchmark::Counter(
+        static_cast<double>(coro_frame_pool.system_allocs_ - before),
+        benchmark::Counter::kAvgIterations);
+}
+
+static void BM_recursive(benchmark::State& state) {
+    int num = state.range(0);
+    int result;
+    for(auto _ : state) {
+        result = 0;
+        recursive(num, result);
+        benchmark::DoNotOptimize(result);
+    }
+}
+static void BM_coro_recursive(benchmark::State& state) {
+    int num = state.range(0);
+    int result = 0;
+    coro_recursive<task>(num, result).run();
+    std::size_t before = coro_frame_pool.system_allocs_;
+    for(auto _ : state) {
+        result = 0;
+        task t = coro_recursive<task>(num, result);
+        t.run();
+        benchmark::DoNotOptimize(result);
+    }
+    report_frame_allocs(state, before);
+}
+static void BM_coro_recursive_heap(benchmark::State& state) {
+    int num = state.range(0);
+    int result;
+    for(auto _ : state) {
+        result = 0;
+        heap_task t = coro_recursive<heap_task>(num, result);
+        t.run();
+        benchmark::DoNotOptimize(result);
+    }
+}
+static void BM_coro_chain(benchmark::State& state) {
+    int num = state.range(0);
+    int result = 0;
+    coro_chain<task>(num, result).run();
+    std::size_t before = coro_frame_pool.system_allocs_;
+    for(auto _ : state) {
+        result = 0;
+        task t = coro_chain<task>(num, result);
+        t.run();
+        benchmark::DoNotOptimize(result);
+    }
+    report_frame_allocs(state, before);
+}
+
+static void BM_DFA_recursive(benchmark::State& state) {
+    int result;
+    Graph G(state.range(0));
+    for(auto _ : state) {
+        result = 0;
+        std::set<int> store;
+        DFA_recursive(G, 0, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+}
+static void BM_DFA_nonrecursive(benchmark::State& state) {
+    int result;
+    Graph G(state.range(0));
+    for(auto _ : state) {
+        result = 0;
+        std::set<int> store;
+        DFA_iterative(G, 0, store, result);
+        benchmark::DoNotOptimize(result);
+    }
+}
+static void BM_coro_DFA_recursive(benchmark::State& state) {
+    int result;
+    Graph G(state.range(0));
+    {
+        std::set<int> store;
+        coro_DFA_recursive<task>(G, 0, store, result).run();
+    }
+    std::size_t before = coro_frame_pool.system_allocs_;
+    for(auto _ : state) {
+        result = 0;
+        std::set<int> store;
+        task t = coro_DFA_recursive<task>(G, 0, store, result);
+        t.run();
+        benchmark::DoNotOptimize(result);
+    }
+    report_frame_allocs(state, before);
+}
+static void BM_coro_DFA_recursive_heap(benchmark::State& state) {
+    int result;
+    Graph G(state.range(0));
+    for(auto _ : state) {
+        result = 0;
+        std::set<int> store;
+        heap_task t = coro_DFA_recursive<heap_task>(G, 0, store, result);
+        t.run();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(BM_recursive)
+    ->Arg(1024*1024)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_coro_recursive)
+    ->Arg(1024*1024)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_coro_recursive_heap)
+    ->Arg(1024*1024)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_coro_chain)
+    ->Arg(1024*1024)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DFA_recursive)
+    ->Arg(10)
+    ->Arg(20)
+    ->Arg(30)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DFA_nonrecursive)
+    ->Arg(10)
+    ->Arg(20)
+    ->Arg(30)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_coro_DFA_recursive)
+    ->Arg(10)
+    ->Arg(20)
+    ->Arg(30)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_coro_DFA_recursive_heap)
+    ->Arg(10)
+    ->Arg(20)
+    ->Arg(30)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_MAIN();
+
+/******
+* Linux x86_64, KVM guest, Intel Xeon (Sapphire Rapids)
+* Run on (1 X 2000 MHz CPU )
+* CPU Caches:
+*   L1 Data 48 KiB (x1)
+*   L1 Instruction 32 KiB (x1)
+*   L2 Unified 2048 KiB (x1)
+*   L3 Unified 107520 KiB (x1)
+* g++ (12.2) RecursionIteration_Coroutine_3.cpp -pthread -std=c++20 -lbenchmark -O3
+* BM_recursive/1048576                 2997 us         2985 us          138
+* BM_coro_recursive/1048576           83922 us        82094 us            5 frame_allocs=0
+* BM_coro_recursive_heap/1048576     173544 us       159292 us            3
+* BM_coro_chain/1048576               62102 us        56622 us            8 frame_allocs=0
+* BM_DFA_recursive/10                  22.5 us         21.8 us        19352
+* BM_DFA_recursive/20                  73.7 us         65.0 us         5360
+* BM_DFA_recursive/30                   134 us          133 us         3400
+* BM_DFA_nonrecursive/10               16.1 us         15.7 us        23666
+* BM_DFA_nonrecursive/20               35.2 us         35.0 us        10000
+* BM_DFA_nonrecursive/30                133 us          131 us         2917
+* BM_coro_DFA_recursive/10             40.1 us         38.3 us        11165 frame_allocs=0
+* BM_coro_DFA_recursive/20              116 us          113 us         3538 frame_allocs=0
+* BM_coro_DFA_recursive/30              217 us          214 us         2048 frame_allocs=0
+* BM_coro_DFA_recursive_heap/10        60.5 us         59.5 us         5982
+* BM_coro_DFA_recursive_heap/20         174 us          171 us         2539
+* BM_coro_DFA_recursive_heap/30         299 us          280 us         1470
+*
+* Observations :
+* 1) The frame pool does what it is supposed to do. After the warm up traversal
+*    frame_allocs is 0, and it halves the cost of the coroutine versions compared
+*    to the default operator new.
+* 2) Even with free allocation the coroutine counting recursion is about 28 times
+*    slower than the plain recursion. The plain recursion is inlined and unrolled
+*    by gcc whereas every coroutine call is an opaque frame setup, an indirect
+*    resume and a destroy. None of it is elided by the compiler here.
+* 3) For the DFA the gap is much smaller (1.5 - 2x) as std::set dominates the
+*    cost of each visit.
+* 4) BM_coro_chain runs a chain one million deep with the default 8MB stack.
+*    Symmetric transfer keeps the native stack flat, the plain recursion of the
+*    same depth would need a frame per level.
+* So a coroutine traversal is a reasonable way of expressing a request handler
+* which suspends, but not a replacement for a tight recursion.
+******/
@@ -0,0 +1,467 @@
+/*****
+* Author : Utsab Singha Roy.
+* T&C : Do whatever you want with it(copy, share, hack, discuss etc) as nothing much
+*       except gaining knowledge can be accomplished with it. 
+*       If using please cite source, don't plagiarize and don't blame me for anything.
+* 
+* The 100 node test graphs and the two DFA implementations used by
+* RecursionIteration_DFA_2.cpp. Kept in a header so that later investigations
+* over the same graphs can measure against exactly the same baseline.
+* The DFA functions are templates over the graph type. A graph needs a node_type
+* and a neighbors(node) returning something range based for can iterate, so they
+* run unchanged on Graph and on the CSR forms from Graph_CSR.h.
+* They are also templates over the visited store. std::set is the original one,
+* anything with test/set (eg. the stores in Graph_VisitedSet.h) works as well.
+* DFA_recursive_profiled and DFA_iterative_profiled are instrumented copies of
+* the two, see Benchmark_TraversalProfile.h.
+******/
+#ifndef RECURSIONITERATION_DFA_H
+#define RECURSIONITERATION_DFA_H
+
+#include<vector>
+#include<set>
+#include<random>
+#include <stack>
+#include "Benchmark_TraversalProfile.h"
+
+struct Graph {
+    typedef int node_type;
+    int node_count = 100;
+    std::vector<std::vector<int>> adjecency_list_;
+    const std::vector<int>& neighbors(int node) const { return adjecency_list_[node]; }
+    /*Same as the python script below, but for any number of nodes and done in
+      process. Connectivity is not checked.*/
+    Graph(int nodes, int conn, unsigned seed) : node_count(nodes) {
+        adjecency_list_.resize(node_count);
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> pick(0, node_count - 1);
+        for(auto& l : adjecency_list_) {
+            l.resize(conn);
+            for(auto& n : l)
+                n = pick(gen);
+        }
+    }
+    Graph(int conn = 10) {
+        adjecency_list_.resize(node_count);
+        /*  Python script to generate random graph of 100 nodes
+            Each node connected to 10 other nodes.
+
+                mylist = list(range(100))
+                for i in mylist:                             
+                    s = "adjecency_list_[" + str(i) + "] = {"
+                    rlist = random.sample(mylist,10)         
+                    for j in rlist:                          
+                            s += str(j) + ","                
+                    s += "};"                                
+                    print s
+        */
+        if(conn == 30) {
+            adjecency_list_[0] = {54,39,14,36,72,74,4,30,67,22,53,92,10,66,18,64,86,7,25,50,41,78,76,85,56,65,81,79,80,37};
+            adjecency_list_[1] = {13,99,66,77,5,71,19,42,80,18,52,25,40,53,49,93,1,74,58,45,82,35,73,91,87,37,28,68,15,81};
+            adjecency_list_[2] = {10,21,88,5,95,47,48,49,61,85,97,2,80,19,36,57,44,14,91,38,25,77,58,65,11,18,64,60,87,42};
+            adjecency_list_[3] = {46,37,55,41,80,22,34,54,6,44,36,52,83,7,11,24,71,99,61,69,51,1,0,9,64,85,88,17,87,50};
+            adjecency_list_[4] = {77,28,50,82,94,45,70,80,92,31,61,40,2,81,72,85,7,19,35,56,76,25,48,99,37,29,22,64,83,53};
+            adjecency_list_[5] = {32,12,65,37,90,79,18,41,46,34,14,70,47,16,3,78,40,93,48,8,89,51,56,38,27,36,24,4,33,71};
+            adjecency_list_[6] = {34,48,35,70,2,76,11,69,49,60,94,59,67,16,43,63,25,39,89,51,7,90,3,18,87,9,17,1,13,81};
+            adjecency_list_[7] = {15,52,3,98,60,35,64,8,30,76,70,63,87,38,95,93,26,92,69,73,7,28,46,19,24,65,47,97,32,88};
+            adjecency_list_[8] = {70,48,38,14,47,72,55,86,60,91,62,21,54,61,19,42,66,89,99,3,58,33,11,17,97,27,90,41,96,5};
+            adjecency_list_[9] = {11,35,29,38,46,66,40,48,68,87,98,19,59,72,88,27,89,3,53,73,77,30,94,24,56,44,13,34,93,86};
+            adjecency_list_[10] = {34,66,56,60,17,78,85,61,63,91,14,72,28,46,95,32,2,9,58,38,79,40,26,41,99,73,1,67,36,25};
+            adjecency_list_[11] = {42,83,18,2,68,67,64,48,70,7,55,72,97,32,66,27,96,84,3,51,80,49,63,24,58,86,23,59,82,38};
+            adjecency_list_[12] = {19,15,63,45,72,20,25,36,94,10,6,77,32,92,74,98,38,46,80,26,91,78,76,14,66,90,24,61,13,93};
+            adjecency_list_[13] = {92,72,39,82,5,33,71,21,81,87,90,80,77,31,50,67,18,91,89,41,24,20,7,35,66,68,38,94,0,23};
+            adjecency_list_[14] = {53,88,48,27,97,45,23,16,33,79,67,90,43,84,11,10,42,63,74,21,98,49,61,38,58,73,50,99,94,77};
+            adjecency_list_[15] = {86,97,75,59,3,21,74,24,8,98,15,82,10,92,95,39,99,12,57,52,27,91,51,14,58,88,56,40,35,26};
+            adjecency_list_[16] = {19,75,47,35,4,8,98,40,88,71,97,41,59,22,31,95,48,46,63,68,89,65,93,9,94,83,14,66,11,27};
+            adjecency_list_[17] = {8,90,79,11,27,0,44,98,56,92,20,26,66,4,69,30,74,24,76,71,43,35,73,51,82,29,13,9,78,17};
+            adjecency_list_[18] = {47,31,44,40,28,65,20,38,57,23,86,50,74,8,48,53,61,21,1,69,43,7,22,18,96,79,51,4,42,59};
+            adjecency_list_[19] = {14,40,21,90,48,77,94,19,29,33,18,37,23,28,15,83,6,17,55,36,3,99,73,5,53,22,70,12,62,32};
+            adjecency_list_[20] = {3,45,11,60,10,33,46,96,68,37,99,1,41,22,54,39,69,56,28,57,79,40,90,50,36,98,42,88,74,32};
+            adjecency_list_[21] = {41,6,45,15,63,84,94,4,32,76,73,62,34,3,52,24,60,79,49,51,97,95,11,8,26,78,82,85,9,20};
+            adjecency_list_[22] = {1,25,10,12,11,23,99,4,43,51,78,63,29,76,60,17,92,62,87,77,22,61,52,14,34,33,84,81,5,48};
+            adjecency_list_[23] = {80,51,99,79,69,6,44,60,95,78,65,70,34,48,37,29,73,87,49,7,16,8,88,12,50,28,55,25,94,85};
+            adjecency_list_[24] = {57,54,20,92,56,1,55,64,97,48,62,26,53,96,50,75,28,14,72,21,24,34,85,10,7,38,46,45,80,33};
+            adjecency_list_[25] = {24,25,20,33,70,57,36,52,49,89,9,99,71,28,31,46,58,6,91,84,82,48,80,78,16,40,81,34,13,56};
+            adjecency_list_[26] = {38,3,0,82,77,67,86,60,32,37,7,94,99,61,92,6,69,18,59,91,66,4,31,84,95,20,5,52,54,36};
+            adjecency_list_[27] = {74,72,48,34,77,23,31,54,84,50,40,57,79,27,25,35,5,26,60,15,22,11,66,10,2,93,53,33,83,78};
+            adjecency_list_[28] = {70,91,60,19,34,13,30,10,6,64,38,52,78,14,66,83,61,41,18,8,75,26,24,81,20,86,73,65,51,74};
+            adjecency_list_[29] = {77,16,43,3,60,61,92,75,98,11,85,81,31,73,34,55,76,84,25,15,36,62,49,54,29,28,8,69,9,97};
+            adjecency_list_[30] = {27,40,92,81,23,60,14,21,41,75,0,5,84,52,87,67,1,53,89,46,62,3,55,73,97,82,49,28,78,33};
+            adjecency_list_[31] = {88,35,98,97,9,11,30,94,81,20,34,64,27,24,46,76,84,72,38,28,91,1,45,53,85,10,54,48,36,13};
+            adjecency_list_[32] = {82,99,77,92,45,56,34,44,85,42,50,9,37,79,46,52,55,29,7,93,95,78,4,54,98,43,72,18,67,68};
+            adjecency_list_[33] = {67,36,59,71,95,84,77,66,29,58,55,64,41,23,62,10,16,2,42,21,19,14,24,6,52,74,7,97,4,37};
+            adjecency_list_[34] = {85,97,29,36,78,66,92,86,8,22,27,57,69,11,5,24,49,7,82,70,12,35,13,17,40,94,10,34,42,16};
+            adjecency_list_[35] = {46,32,10,55,57,1,78,81,37,96,88,33,98,90,56,92,43,74,9,80,35,84,79,47,70,11,34,89,20,73};
+            adjecency_list_[36] = {65,91,78,64,25,89,47,80,72,14,41,54,4,13,88,71,8,37,39,83,61,73,40,22,26,95,29,1,53,34};
+            adjecency_list_[37] = {45,76,59,22,65,48,86,29,16,94,89,47,74,72,1,87,66,58,75,33,18,27,42,20,12,56,31,32,80,15};
+            adjecency_list_[38] = {41,71,3,84,17,95,26,88,45,79,10,16,30,33,58,77,49,7,42,25,15,61,63,59,92,89,20,4,67,28};
+            adjecency_list_[39] = {64,69,35,57,33,74,73,55,50,85,28,65,51,38,3,6,23,36,95,17,59,8,45,87,48,56,24,71,98,46};
+            adjecency_list_[40] = {36,76,46,99,47,42,22,9,74,64,1,73,35,66,44,0,82,12,52,98,80,75,34,11,62,4,49,16,41,88};
+            adjecency_list_[41] = {83,56,8,60,35,72,63,86,76,7,37,79,58,41,75,29,71,21,45,53,78,57,54,77,98,22,64,66,17,40};
+            adjecency_list_[42] = {51,79,59,3,20,39,54,46,99,55,63,58,11,35,26,9,22,31,90,91,6,5,40,72,70,1,97,81,67,74};
+            adjecency_list_[43] = {60,29,97,84,54,90,13,75,22,61,98,59,2,37,1,12,49,8,80,79,91,58,7,43,65,0,21,57,62,10};
+            adjecency_list_[44] = {40,84,85,9,86,8,14,68,3,17,4,69,52,70,53,26,0,49,65,41,25,46,80,67,38,71,12,43,48,58};
+            adjecency_list_[45] = {0,26,52,23,68,44,29,88,87,43,65,37,79,14,22,62,85,47,98,10,41,89,94,7,55,60,66,71,75,24};
+            adjecency_list_[46] = {44,95,50,31,69,83,8,86,74,5,16,84,4,10,30,29,85,48,19,3,93,97,70,27,43,71,87,96,25,39};
+            adjecency_list_[47] = {74,47,70,43,42,76,39,85,1,0,9,99,86,5,81,61,52,31,75,8,20,60,30,72,77,37,51,2,26,80};
+            adjecency_list_[48] = {48,29,17,89,10,8,70,33,99,69,31,39,79,52,13,7,21,26,47,40,75,62,68,9,92,19,3,91,78,57};
+            adjecency_list_[49] = {68,45,50,8,95,46,78,29,6,37,35,60,77,89,94,17,91,87,86,24,0,57,53,62,18,15,30,67,19,81};
+            adjecency_list_[50] = {6,99,29,88,24,22,4,82,52,41,83,0,90,13,48,27,59,95,75,35,5,57,47,25,98,23,69,78,72,40};
+            adjecency_list_[51] = {73,47,85,35,90,88,45,33,83,63,98,20,43,52,94,86,67,26,79,36,40,91,21,89,13,11,93,28,78,54};
+            adjecency_list_[52] = {26,56,80,24,43,46,62,36,72,87,74,92,50,3,96,39,66,31,28,95,16,47,23,40,17,20,90,82,7,5};
+            adjecency_list_[53] = {20,59,11,40,85,90,60,73,89,33,81,17,62,61,55,28,18,27,3,24,53,99,58,94,82,88,39,87,16,37};
+            adjecency_list_[54] = {24,35,74,27,48,7,79,68,65,60,0,83,67,63,90,53,25,75,89,12,28,2,34,72,42,87,86,99,54,43};
+            adjecency_list_[55] = {60,85,32,98,72,68,91,50,53,61,69,45,13,83,38,31,11,30,28,41,12,76,48,80,67,25,1,0,4,75};
+            adjecency_list_[56] = {28,73,39,23,82,26,18,78,9,31,14,72,56,20,15,76,24,77,25,12,53,64,10,70,52,92,37,97,74,46};
+            adjecency_list_[57] = {54,0,7,3,99,29,63,61,12,9,55,83,97,89,39,2,4,88,94,52,93,69,45,51,82,95,68,43,16,65};
+            adjecency_list_[58] = {51,57,65,8,41,63,62,55,97,38,0,17,42,13,80,69,59,25,29,15,1,56,44,26,28,34,45,47,74,16};
+            adjecency_list_[59] = {86,31,46,68,36,59,57,90,61,81,56,43,66,80,2,91,40,12,78,64,10,32,88,87,54,98,49,51,71,5};
+            adjecency_list_[60] = {49,66,11,27,76,59,52,40,18,2,56,25,42,29,34,36,9,87,39,44,10,53,37,51,74,68,61,24,80,83};
+            adjecency_list_[61] = {44,21,54,88,52,67,39,43,73,7,40,50,85,84,71,36,72,28,47,10,95,42,79,81,83,30,3,58,60,96};
+            adjecency_list_[62] = {23,82,70,57,58,87,56,2,79,4,45,65,62,24,74,93,5,39,21,89,51,52,64,7,20,1,95,66,78,3};
+            adjecency_list_[63] = {98,7,16,24,75,49,22,44,9,53,88,0,10,18,96,56,34,80,11,2,87,74,42,4,81,25,36,39,63,68};
+            adjecency_list_[64] = {40,2,72,91,0,9,16,83,29,32,42,88,33,77,57,30,13,17,25,82,44,51,28,18,67,52,55,27,24,56};
+            adjecency_list_[65] = {61,88,76,59,13,38,35,28,60,71,81,26,3,12,31,43,48,99,67,94,49,84,47,87,30,8,73,83,89,91};
+            adjecency_list_[66] = {15,25,18,61,45,93,47,6,50,37,13,0,41,71,54,44,46,57,65,72,77,62,8,49,14,19,67,73,88,94};
+            adjecency_list_[67] = {9,35,80,49,38,43,6,60,0,98,34,30,29,84,5,88,53,28,95,62,26,85,36,46,78,66,40,50,12,65};
+            adjecency_list_[68] = {3,12,98,94,91,15,84,39,22,19,35,83,26,33,75,62,85,73,63,20,82,4,28,74,60,93,17,1,25,41};
+            adjecency_list_[69] = {90,74,78,73,39,65,16,89,50,26,91,15,57,30,72,14,71,67,7,97,24,34,88,62,75,10,66,99,19,42};
+            adjecency_list_[70] = {31,25,52,46,69,89,66,78,92,6,30,93,7,58,38,60,8,59,67,80,49,0,33,82,88,56,98,27,51,26};
+            adjecency_list_[71] = {11,63,51,5,29,53,96,79,85,93,87,98,1,64,58,75,89,37,20,91,18,95,7,49,46,78,14,23,21,6};
+            adjecency_list_[72] = {30,5,92,11,17,31,95,67,85,33,77,99,69,73,54,68,57,59,87,25,46,39,18,36,27,35,29,80,14,23};
+            adjecency_list_[73] = {74,36,0,46,51,49,84,31,55,38,6,90,66,98,35,45,25,40,97,39,52,4,83,93,48,99,9,75,76,30};
+            adjecency_list_[74] = {62,29,78,57,92,84,81,6,80,91,65,52,68,13,71,60,46,32,30,23,40,53,1,31,24,41,90,39,61,70};
+            adjecency_list_[75] = {26,85,68,60,10,35,57,7,59,93,44,14,20,36,81,83,23,15,91,28,69,27,56,2,3,39,51,82,42,84};
+            adjecency_list_[76] = {52,97,46,71,53,79,5,60,32,48,21,96,7,0,81,29,13,45,39,3,23,84,95,12,37,89,1,28,33,55};
+            adjecency_list_[77] = {41,18,3,45,91,58,36,47,16,32,53,4,76,6,49,75,56,17,21,12,66,13,2,51,33,96,72,52,59,82};
+            adjecency_list_[78] = {94,24,0,90,45,74,69,16,28,6,81,75,76,64,67,29,20,46,32,27,89,15,51,83,85,92,96,88,17,91};
+            adjecency_list_[79] = {87,53,65,3,33,97,49,55,29,68,62,11,96,22,16,90,10,93,6,76,8,5,50,4,81,91,71,67,80,99};
+            adjecency_list_[80] = {64,8,66,59,88,41,61,62,22,83,46,42,34,40,54,13,71,60,33,4,81,11,94,29,23,89,93,3,26,19};
+            adjecency_list_[81] = {83,92,79,5,57,9,11,88,74,8,95,30,67,39,70,76,78,81,64,68,97,1,36,18,72,53,82,29,33,51};
+            adjecency_list_[82] = {91,72,11,27,78,2,8,19,90,36,92,3,20,81,52,47,97,75,69,21,42,94,89,35,57,62,76,98,68,0};
+            adjecency_list_[83] = {34,88,11,37,67,24,10,57,14,94,75,33,62,9,78,28,91,16,50,93,49,46,36,13,52,5,22,29,96,82};
+            adjecency_list_[84] = {78,48,69,15,1,81,76,32,62,26,66,33,8,7,88,93,23,10,22,63,11,57,45,29,4,39,47,83,17,77};
+            adjecency_list_[85] = {30,13,43,46,88,57,93,49,68,86,75,12,33,4,31,84,26,97,17,16,29,99,0,25,51,60,11,58,80,89};
+            adjecency_list_[86] = {0,11,56,16,96,46,79,32,69,85,27,51,87,39,98,60,6,15,91,9,86,71,83,57,5,65,62,67,31,43};
+            adjecency_list_[87] = {33,81,46,25,76,70,51,47,2,52,36,84,3,60,74,77,69,55,93,40,21,49,83,97,99,30,78,64,39,96};
+            adjecency_list_[88] = {83,28,53,76,5,57,64,80,89,47,62,52,63,69,94,25,65,0,6,48,35,43,15,9,74,23,60,44,91,50};
+            adjecency_list_[89] = {78,48,6,9,71,58,64,65,45,55,22,99,26,92,49,10,72,32,27,47,73,61,63,80,74,41,39,97,46,69};
+            adjecency_list_[90] = {47,59,63,87,20,68,41,33,22,93,48,90,44,36,27,83,73,81,30,94,97,55,62,98,53,3,85,13,61,77};
+            adjecency_list_[91] = {58,14,52,34,19,27,88,56,98,70,6,40,94,73,39,4,17,78,45,57,63,36,59,90,15,53,60,83,35,62};
+            adjecency_list_[92] = {25,68,38,89,83,47,69,94,61,64,99,56,13,51,44,39,66,15,28,36,70,95,18,7,1,81,65,22,71,50};
+            adjecency_list_[93] = {86,1,63,56,9,96,98,65,28,11,70,29,38,6,79,80,27,87,64,67,12,95,47,50,42,69,0,32,36,43};
+            adjecency_list_[94] = {16,5,57,18,99,22,10,17,69,35,85,47,80,94,74,24,33,82,87,96,93,67,4,58,14,11,52,42,55,86};
+            adjecency_list_[95] = {76,4,81,91,94,75,67,26,98,18,25,70,85,50,86,46,35,83,33,63,89,16,2,77,29,52,7,71,73,82};
+            adjecency_list_[96] = {94,81,9,65,28,84,57,85,39,77,64,62,5,66,88,19,27,74,38,34,47,87,80,37,36,10,26,25,45,67};
+            adjecency_list_[97] = {50,85,91,0,38,62,5,93,20,73,36,76,43,21,56,40,86,17,55,90,92,87,75,98,59,61,24,25,39,18};
+            adjecency_list_[98] = {79,9,3,40,47,12,38,41,11,75,55,24,64,60,92,66,29,86,5,52,65,90,27,71,68,25,18,61,78,39};
+            adjecency_list_[99] = {74,69,44,8,24,35,16,70,4,42,21,32,43,52,56,20,84,5,58,36,61,77,48,57,26,94,63,95,72,54};    
+        }
+        else if (conn == 20) {
+            adjecency_list_[0] = {48,89,98,41,19,79,27,44,34,96,82,3,22,51,42,7,49,55,9,2};
+            adjecency_list_[1] = {11,16,20,37,14,74,58,2,5,44,10,25,87,7,35,85,50,76,57,43};
+            adjecency_list_[2] = {52,31,21,46,91,28,29,85,62,12,11,71,20,56,9,37,88,10,75,35};
+            adjecency_list_[3] = {56,54,17,11,79,1,62,36,5,90,40,13,69,48,96,25,80,63,65,0};
+            adjecency_list_[4] = {81,91,9,60,5,40,79,26,27,58,8,33,39,23,19,66,77,90,2,87};
+            adjecency_list_[5] = {8,15,20,22,60,6,75,97,45,76,38,69,63,42,25,31,80,49,5,2};
+            adjecency_list_[6] = {81,95,97,69,17,20,53,32,54,83,24,18,2,85,99,66,3,1,41,27};
+            adjecency_list_[7] = {9,60,40,56,58,55,39,16,37,33,77,57,81,68,42,66,64,2,93,96};
+            adjecency_list_[8] = {9,27,55,81,80,54,75,65,49,47,90,42,24,93,18,30,5,72,19,4};
+            adjecency_list_[9] = {98,21,12,50,31,15,23,39,2,96,34,81,97,54,14,16,73,63,79,35};
+            adjecency_list_[10] = {41,36,72,66,91,95,45,80,46,70,73,92,8,87,47,49,9,42,75,3};
+            adjecency_list_[11] = {21,30,0,84,50,55,35,8,44,47,92,14,74,26,11,10,60,4,19,16};
+            adjecency_list_[12] = {72,52,53,15,56,54,22,28,35,37,63,50,69,98,12,21,86,34,40,24};
+            adjecency_list_[13] = {11,70,1,15,23,74,51,9,92,56,13,27,91,32,75,77,80,46,39,73};
+            adjecency_list_[14] = {99,63,85,9,3,7,76,0,47,17,6,27,14,66,23,22,84,39,70,89};
+            adjecency_list_[15] = {72,76,24,5,98,44,79,40,80,41,10,64,14,37,61,23,50,46,21,62};
+            adjecency_list_[16] = {6,3,76,49,87,42,69,78,14,64,36,41,28,73,38,52,75,31,56,22};
+            adjecency_list_[17] = {73,53,4,83,47,17,3,96,29,90,26,46,14,28,30,60,54,21,97,0};
+            adjecency_list_[18] = {81,65,57,1,59,87,4,13,64,61,74,56,49,26,76,67,40,12,14,41};
+            adjecency_list_[19] = {69,76,3,73,18,91,28,94,49,70,29,78,31,33,38,53,24,72,55,68};
+            adjecency_list_[20] = {51,53,16,58,30,43,36,0,95,38,48,21,78,79,63,67,93,61,46,24};
+            adjecency_list_[21] = {30,7,15,33,44,42,36,38,87,37,11,25,41,59,83,20,24,93,68,79};
+            adjecency_list_[22] = {7,80,11,57,93,8,88,60,94,74,2,21,12,19,29,56,67,30,58,43};
+            adjecency_list_[23] = {49,95,17,64,85,69,87,54,79,52,4,2,56,91,96,93,10,75,68,34};
+            adjecency_list_[24] = {18,45,54,7,71,86,94,57,32,97,4,55,53,11,93,29,92,95,87,79};
+            adjecency_list_[25] = {95,83,33,69,55,92,82,34,40,0,12,73,65,32,5,22,25,1,81,72};
+            adjecency_list_[26] = {33,65,25,35,92,86,96,83,98,15,8,23,95,36,4,79,60,91,27,32};
+            adjecency_list_[27] = {89,93,31,17,87,9,77,67,18,81,21,56,91,92,63,36,29,65,73,26};
+            adjecency_list_[28] = {92,8,75,87,64,23,63,71,74,41,22,19,14,84,10,35,47,69,7,31};
+            adjecency_list_[29] = {86,35,37,70,27,45,43,39,16,7,22,56,19,98,13,15,41,4,96,32};
+            adjecency_list_[30] = {57,44,42,40,33,1,74,63,14,98,8,39,91,30,62,4,43,29,27,65};
+            adjecency_list_[31] = {78,33,90,27,65,16,82,19,77,15,85,36,42,8,39,97,74,43,13,2};
+            adjecency_list_[32] = {53,3,51,6,39,76,67,13,31,8,56,11,33,92,25,78,28,57,1,86};
+            adjecency_list_[33] = {88,67,3,17,1,2,52,9,66,63,8,76,73,62,29,32,99,92,87,40};
+            adjecency_list_[34] = {0,28,87,81,48,6,27,3,61,14,60,94,37,12,65,21,82,47,43,68};
+            adjecency_list_[35] = {97,76,13,54,65,74,87,33,67,29,47,46,21,49,25,31,71,55,83,56};
+            adjecency_list_[36] = {14,27,74,50,57,40,58,31,68,41,65,70,73,59,86,7,61,66,64,71};
+            adjecency_list_[37] = {96,67,56,83,20,93,59,33,49,47,18,0,10,32,9,62,60,46,63,65};
+            adjecency_list_[38] = {81,47,70,99,14,89,5,65,45,10,12,85,63,46,0,95,86,34,78,27};
+            adjecency_list_[39] = {3,16,44,34,27,97,40,11,58,43,55,7,5,21,88,99,2,4,49,56};
+            adjecency_list_[40] = {46,64,26,1,36,68,18,19,41,13,42,37,49,82,0,98,52,63,40,73};
+            adjecency_list_[41] = {13,36,80,54,35,78,94,85,79,2,41,6,51,20,84,83,38,93,69,22};
+            adjecency_list_[42] = {20,61,13,24,60,3,53,84,29,86,17,99,15,72,39,71,94,95,5,18};
+            adjecency_list_[43] = {78,61,59,58,73,18,45,13,37,84,55,21,56,11,79,74,88,87,32,97};
+            adjecency_list_[44] = {72,95,44,38,25,45,14,65,51,22,37,64,53,96,78,87,60,93,15,12};
+            adjecency_list_[45] = {91,90,43,60,1,19,36,21,37,83,78,54,38,18,50,57,81,17,32,6};
+            adjecency_list_[46] = {86,0,78,4,11,90,61,99,62,37,38,34,16,59,81,29,39,52,96,97};
+            adjecency_list_[47] = {9,50,51,44,11,23,88,5,49,73,22,25,33,3,46,10,89,71,39,58};
+            adjecency_list_[48] = {87,91,37,28,29,90,97,48,46,27,51,43,95,50,81,13,14,12,60,21};
+            adjecency_list_[49] = {63,62,52,11,27,20,23,44,56,51,21,16,22,15,1,32,55,35,90,94};
+            adjecency_list_[50] = {45,99,97,86,94,48,90,71,69,1,6,58,46,52,24,93,64,56,73,89};
+            adjecency_list_[51] = {14,47,19,94,0,70,76,12,33,66,22,90,7,98,55,17,27,88,46,42};
+            adjecency_list_[52] = {31,23,9,45,71,42,67,65,3,46,82,75,41,77,5,68,88,34,73,44};
+            adjecency_list_[53] = {60,52,90,7,91,75,2,31,59,84,14,23,20,44,13,34,82,54,5,71};
+            adjecency_list_[54] = {60,96,17,34,24,15,40,88,36,90,45,98,13,19,21,47,11,51,31,99};
+            adjecency_list_[55] = {18,26,45,90,34,35,50,84,7,77,72,30,22,67,82,87,68,8,49,75};
+            adjecency_list_[56] = {6,85,66,19,99,1,79,24,63,41,60,30,12,31,15,75,42,87,67,70};
+            adjecency_list_[57] = {92,30,53,89,77,25,61,44,6,71,1,8,19,64,79,42,81,20,99,86};
+            adjecency_list_[58] = {28,93,21,65,49,91,78,87,71,83,34,12,37,99,11,1,42,10,73,54};
+            adjecency_list_[59] = {64,95,59,91,88,53,31,68,40,89,28,93,9,75,18,54,3,80,12,69};
+            adjecency_list_[60] = {57,78,5,70,29,18,53,13,99,36,38,59,56,94,7,63,79,51,92,80};
+            adjecency_list_[61] = {1,47,25,50,9,6,98,20,73,45,58,64,16,19,41,87,7,37,23,27};
+            adjecency_list_[62] = {19,99,48,53,63,51,4,75,89,95,45,72,3,28,62,41,6,58,96,66};
+            adjecency_list_[63] = {88,67,27,73,43,11,72,84,9,41,45,37,68,98,4,96,62,99,86,10};
+            adjecency_list_[64] = {75,85,57,7,48,12,10,69,1,22,52,93,19,18,59,94,56,82,73,41};
+            adjecency_list_[65] = {89,52,36,19,40,97,91,44,55,12,17,43,16,51,11,76,42,63,54,87};
+            adjecency_list_[66] = {15,14,22,52,30,99,85,57,16,71,32,78,27,84,48,20,40,11,18,60};
+            adjecency_list_[67] = {40,63,47,46,27,66,62,87,67,0,52,95,54,24,44,78,5,28,51,81};
+            adjecency_list_[68] = {39,36,89,20,40,37,43,13,58,55,87,69,0,57,9,6,66,24,2,81};
+            adjecency_list_[69] = {78,9,84,79,27,73,18,68,97,13,39,54,53,41,90,22,60,12,88,76};
+            adjecency_list_[70] = {47,54,13,95,39,78,49,26,41,21,61,37,53,25,59,99,42,91,57,19};
+            adjecency_list_[71] = {38,80,18,1,84,76,19,14,29,16,71,48,32,55,78,22,59,77,79,51};
+            adjecency_list_[72] = {16,24,82,93,79,21,0,14,11,86,42,23,2,52,70,92,68,20,80,4};
+            adjecency_list_[73] = {48,0,53,74,46,57,11,13,98,43,32,88,81,23,82,17,10,61,78,15};
+            adjecency_list_[74] = {21,57,58,53,88,76,19,22,46,62,28,15,32,40,44,75,2,71,56,38};
+            adjecency_list_[75] = {20,68,90,30,23,87,50,35,57,40,12,91,47,37,44,94,49,2,53,64};
+            adjecency_list_[76] = {47,3,75,23,43,39,95,97,6,63,34,48,11,7,31,0,28,57,66,74};
+            adjecency_list_[77] = {18,21,80,22,88,7,52,37,57,53,13,68,2,11,40,50,36,9,98,47};
+            adjecency_list_[78] = {5,35,2,28,69,97,7,82,22,44,9,77,70,16,63,3,94,42,11,17};
+            adjecency_list_[79] = {0,98,36,54,72,65,43,68,66,99,91,71,81,57,51,14,90,35,92,23};
+            adjecency_list_[80] = {46,41,53,52,59,98,93,70,50,26,8,72,25,20,83,21,2,7,10,62};
+            adjecency_list_[81] = {86,63,87,6,33,96,73,11,90,36,91,94,46,20,71,85,52,44,10,17};
+            adjecency_list_[82] = {25,97,3,77,47,13,78,11,44,23,80,9,24,6,72,96,40,85,69,87};
+            adjecency_list_[83] = {77,79,73,11,50,98,0,88,40,67,55,15,25,20,76,80,92,87,48,37};
+            adjecency_list_[84] = {21,70,95,62,2,44,76,73,88,19,91,7,38,97,72,33,53,82,83,40};
+            adjecency_list_[85] = {82,28,11,59,95,67,18,24,70,81,22,14,66,93,86,73,74,94,12,39};
+            adjecency_list_[86] = {57,22,98,31,34,64,59,35,44,58,48,10,74,81,4,45,52,87,24,39};
+            adjecency_list_[87] = {62,80,61,39,13,69,79,43,14,54,83,76,26,37,60,51,44,25,92,20};
+            adjecency_list_[88] = {66,35,6,29,26,12,4,24,81,0,70,91,77,57,69,28,43,2,19,60};
+            adjecency_list_[89] = {47,99,16,46,2,14,20,71,40,62,64,80,19,97,18,37,66,24,92,21};
+            adjecency_list_[90] = {11,35,36,89,24,0,67,76,6,73,49,68,34,16,63,96,86,10,95,59};
+            adjecency_list_[91] = {92,3,46,34,26,74,61,11,7,64,90,93,53,0,66,68,16,57,75,18};
+            adjecency_list_[92] = {1,45,20,53,52,65,4,76,61,62,25,84,12,31,69,8,68,5,93,94};
+            adjecency_list_[93] = {4,23,49,48,53,91,82,30,28,95,15,12,18,67,26,40,85,88,77,55};
+            adjecency_list_[94] = {39,37,95,99,44,42,60,30,70,21,72,0,89,83,56,48,40,66,98,46};
+            adjecency_list_[95] = {39,90,41,53,55,14,7,62,91,95,50,59,1,80,68,48,17,19,98,30};
+            adjecency_list_[96] = {25,68,60,64,51,21,18,45,37,87,75,46,5,41,11,49,3,91,2,33};
+            adjecency_list_[97] = {71,64,61,58,27,99,5,41,87,33,24,60,13,10,67,98,8,96,3,59};
+            adjecency_list_[98] = {17,50,91,80,6,69,40,95,60,61,24,73,12,36,49,35,29,51,1,84};
+            adjecency_list_[99] = {36,48,61,35,30,40,20,32,50,73,14,23,93,75,65,80,76,41,27,66};    
+        }
+        else {
+            adjecency_list_[0] = {79,19,38,95,13,75,7,62,90,14};
+            adjecency_list_[1] = {78,79,21,12,96,93,92,25,75,58};
+            adjecency_list_[2] = {17,69,39,51,68,32,26,56,97,43};
+            adjecency_list_[3] = {48,7,8,65,60,66,92,84,42,52};
+            adjecency_list_[4] = {43,69,55,46,4,74,88,89,14,6};
+            adjecency_list_[5] = {80,75,15,64,32,50,56,70,4,8};
+            adjecency_list_[6] = {44,72,15,92,79,43,50,36,76,3};
+            adjecency_list_[7] = {51,57,19,16,85,49,14,94,5,91};
+            adjecency_list_[8] = {76,14,81,28,2,88,73,45,71,82};
+            adjecency_list_[9] = {11,25,32,80,97,37,47,99,71,79};
+            adjecency_list_[10] = {97,65,11,69,95,39,17,28,26,55};
+            adjecency_list_[11] = {65,59,54,96,94,25,46,76,86,4};
+            adjecency_list_[12] = {12,92,29,74,13,38,10,2,69,30};
+            adjecency_list_[13] = {82,50,28,15,52,56,23,54,35,20};
+            adjecency_list_[14] = {17,24,68,60,29,53,8,66,7,85};
+            adjecency_list_[15] = {18,20,43,44,71,38,79,63,85,95};
+            adjecency_list_[16] = {79,37,24,3,19,92,35,56,81,54};
+            adjecency_list_[17] = {17,35,82,37,61,40,98,76,41,23};
+            adjecency_list_[18] = {37,74,1,30,7,0,93,51,2,50};
+            adjecency_list_[19] = {17,15,60,72,87,95,50,73,47,35};
+            adjecency_list_[20] = {69,2,14,44,39,29,19,51,93,71};
+            adjecency_list_[21] = {81,65,60,5,26,82,9,32,58,64};
+            adjecency_list_[22] = {79,5,40,2,77,0,71,87,41,51};
+            adjecency_list_[23] = {18,84,50,51,6,41,29,23,76,67};
+            adjecency_list_[24] = {88,64,8,69,91,9,92,62,99,18};
+            adjecency_list_[25] = {57,24,45,85,76,29,81,86,53,13};
+            adjecency_list_[26] = {78,31,79,76,67,26,92,4,51,82};
+            adjecency_list_[27] = {99,98,62,39,22,70,18,90,4,66};
+            adjecency_list_[28] = {19,81,72,51,94,71,68,59,75,88};
+            adjecency_list_[29] = {68,73,33,70,52,18,42,87,78,31};
+            adjecency_list_[30] = {75,94,24,83,54,0,81,31,66,92};
+            adjecency_list_[31] = {46,1,24,38,89,95,16,8,6,81};
+            adjecency_list_[32] = {32,60,45,57,73,94,80,75,46,24};
+            adjecency_list_[33] = {21,15,4,82,59,30,51,0,89,97};
+            adjecency_list_[34] = {86,74,2,4,16,96,42,72,27,77};
+            adjecency_list_[35] = {34,11,64,72,25,19,59,16,75,82};
+            adjecency_list_[36] = {98,24,16,6,39,90,1,82,73,26};
+            adjecency_list_[37] = {98,96,1,77,18,5,19,79,8,82};
+            adjecency_list_[38] = {5,74,2,22,63,32,66,91,38,31};
+            adjecency_list_[39] = {43,35,95,0,91,47,97,32,98,96};
+            adjecency_list_[40] = {26,75,95,60,97,24,88,13,29,8};
+            adjecency_list_[41] = {72,42,99,1,3,67,43,19,53,29};
+            adjecency_list_[42] = {24,11,43,9,32,35,78,4,92,65};
+            adjecency_list_[43] = {91,8,71,49,79,70,42,81,35,19};
+            adjecency_list_[44] = {32,90,52,97,53,15,81,31,5,56};
+            adjecency_list_[45] = {0,52,40,96,16,98,63,59,90,76};
+            adjecency_list_[46] = {15,67,94,60,84,63,29,26,86,82};
+            adjecency_list_[47] = {65,54,25,64,46,37,12,0,87,2};
+            adjecency_list_[48] = {92,67,3,17,94,24,62,22,73,10};
+            adjecency_list_[49] = {16,79,77,91,4,70,21,20,3,12};
+            adjecency_list_[50] = {37,31,87,52,7,22,42,13,0,3};
+            adjecency_list_[51] = {91,48,11,57,79,26,29,36,54,28};
+            adjecency_list_[52] = {70,60,16,43,48,58,57,92,34,77};
+            adjecency_list_[53] = {68,43,82,61,31,3,90,49,76,62};
+            adjecency_list_[54] = {13,35,99,36,75,68,43,19,0,92};
+            adjecency_list_[55] = {39,83,70,90,25,32,62,24,49,34};
+            adjecency_list_[56] = {11,67,44,83,97,84,20,32,57,96};
+            adjecency_list_[57] = {39,91,26,16,63,27,10,2,78,19};
+            adjecency_list_[58] = {5,73,13,10,8,12,77,20,58,2};
+            adjecency_list_[59] = {42,5,52,48,92,1,4,41,12,93};
+            adjecency_list_[60] = {14,23,43,71,86,98,34,49,65,64};
+            adjecency_list_[61] = {88,51,94,76,92,32,74,29,81,57};
+            adjecency_list_[62] = {72,90,86,67,49,99,35,65,98,95};
+            adjecency_list_[63] = {3,4,39,79,32,13,85,51,46,78};
+            adjecency_list_[64] = {28,23,83,25,18,41,7,26,14,71};
+            adjecency_list_[65] = {16,62,68,51,48,18,11,36,24,40};
+            adjecency_list_[66] = {7,48,66,9,55,42,17,37,77,30};
+            adjecency_list_[67] = {75,18,32,72,42,23,68,13,50,85};
+            adjecency_list_[68] = {66,45,70,74,13,72,10,51,88,47};
+            adjecency_list_[69] = {40,28,23,67,73,29,33,12,99,84};
+            adjecency_list_[70] = {58,74,12,72,92,45,23,93,18,91};
+            adjecency_list_[71] = {56,64,54,10,75,46,13,35,11,2};
+            adjecency_list_[72] = {2,93,43,67,35,50,37,34,52,3};
+            adjecency_list_[73] = {64,83,26,42,7,14,1,16,36,58};
+            adjecency_list_[74] = {67,83,95,18,2,35,85,49,88,69};
+            adjecency_list_[75] = {39,8,65,15,26,85,54,32,81,30};
+            adjecency_list_[76] = {29,92,49,0,26,13,79,28,75,98};
+            adjecency_list_[77] = {31,56,10,12,95,30,64,43,37,50};
+            adjecency_list_[78] = {96,23,9,48,50,81,45,60,31,66};
+            adjecency_list_[79] = {41,94,78,90,62,1,43,91,28,42};
+            adjecency_list_[80] = {87,98,57,56,99,25,8,77,3,5};
+            adjecency_list_[81] = {40,4,77,18,98,34,84,16,11,74};
+            adjecency_list_[82] = {10,42,11,43,38,61,73,54,27,34};
+            adjecency_list_[83] = {47,91,7,17,57,29,55,59,72,54};
+            adjecency_list_[84] = {74,60,96,10,54,48,87,80,40,56};
+            adjecency_list_[85] = {39,12,7,34,16,77,14,23,41,69};
+            adjecency_list_[86] = {73,77,23,22,26,43,91,18,54,89};
+            adjecency_list_[87] = {61,34,79,1,22,85,58,24,6,31};
+            adjecency_list_[88] = {94,42,47,95,52,68,72,35,97,12};
+            adjecency_list_[89] = {13,47,84,50,15,89,85,75,60,71};
+            adjecency_list_[90] = {39,97,84,65,17,7,22,92,64,67};
+            adjecency_list_[91] = {10,41,98,51,35,12,59,78,81,77};
+            adjecency_list_[92] = {58,34,45,33,38,70,16,30,86,41};
+            adjecency_list_[93] = {95,22,16,35,33,59,91,82,27,77};
+            adjecency_list_[94] = {71,0,28,80,31,51,35,56,68,87};
+            adjecency_list_[95] = {61,88,98,42,11,1,24,63,72,67};
+            adjecency_list_[96] = {48,76,27,55,38,60,23,70,49,35};
+            adjecency_list_[97] = {53,32,62,93,11,79,85,18,55,4};
+            adjecency_list_[98] = {66,9,60,70,98,42,69,37,20,32};
+            adjecency_list_[99] = {47,79,39,91,98,66,40,33,48,13};
+
+        }
+    }
+};
+
+template<typename Node, typename Compare, typename Alloc>
+void set_visited(Node node, std::set<Node, Compare, Alloc>& store) {
+    store.insert(node);
+}
+template<typename Node, typename Compare, typename Alloc>
+bool is_visited(Node node, const std::set<Node, Compare, Alloc>& store) {
+    return store.find(node) != store.end();
+}
+template<typename Node, typename Store>
+void set_visited(Node node, Store& store) {
+    store.set(node);
+}
+template<typename Node, typename Store>
+bool is_visited(Node node, const Store& store) {
+    return store.test(node);
+}
+
+template<typename G, typename Store>
+void DFA_recursive(const G& g, typename G::node_type root, Store& store, int& count) {
+    if(is_visited(root, store))
+        return;
+    set_visited(root, store);
+    ++count;
+    for(auto i : g.neighbors(root)) {
+        DFA_recursive(g, i, store, count);    
+    }
+}
+
+template<typename G, typename Store>
+void DFA_iterative(const G& g, typename G::node_type root, Store& store, int& count) {
+    std::stack<typename G::node_type> S;
+    S.push(root);
+    while(!S.empty()) {
+        auto node = S.top();
+        S.pop();
+        if(is_visited(node, store))
+            continue;
+        count++;
+        set_visited(node, store);
+        for(auto i : g.neighbors(node))
+            S.push(i);
+    }
+}
+
+/*Copies of DFA_recursive and DFA_iterative which record where their time goes
+  when built with -DTRAVERSAL_PROFILE (Benchmark_TraversalProfile.h). Kept apart
+  so that the two above stay exactly as they were measured.*/
+template<typename G, typename Store>
+void DFA_recursive_profiled(const G& g, typename G::node_type root, Store& store, int& count) {
+    traversal_profile& profile = this_thread_profile();
+    profile.enter(PHASE_VISITED);
+    if(is_visited(root, store)) {
+        profile.duplicate();
+        profile.enter(PHASE_STACK);
+        return;
+    }
+    set_visited(root, store);
+    ++count;
+    profile.visit();
+    profile.enter(PHASE_ADJACENCY);
+    for(auto i : g.neighbors(root)) {
+        profile.enter(PHASE_STACK);
+        profile.edge(profile.descend());
+        DFA_recursive_profiled(g, i, store, count);
+        profile.ascend();
+        profile.enter(PHASE_ADJACENCY);
+    }
+    profile.enter(PHASE_STACK);
+}
+
+template<typename G, typename Store>
+void DFA_iterative_profiled(const G& g, typename G::node_type root, Store& store, int& count) {
+    traversal_profile& profile = this_thread_profile();
+    profile.enter(PHASE_STACK);
+    std::stack<typename G::node_type> S;
+    S.push(root);
+    while(!S.empty()) {
+        auto node = S.top();
+        S.pop();
+        profile.enter(PHASE_VISITED);
+        if(is_visited(node, store)) {
+            profile.duplicate();
+            profile.enter(PHASE_STACK);
+            continue;
+        }
+        count++;
+        set_visited(node, store);
+        profile.visit();
+        profile.enter(PHASE_ADJACENCY);
+        for(auto i : g.neighbors(node)) {
+            profile.enter(PHASE_STACK);
+            S.push(i);
+            profile.edge(S.size());
+            profile.enter(PHASE_ADJACENCY);
+        }
+        profile.enter(PHASE_STACK);
+    }
+}
+
+#endif